@@ -34,8 +34,17 @@ public class JSONParser : ModuleRules
 			{
 				"CoreUObject",
 				"Engine",
+				"ImageWrapper",
                 "HTTP"
             }
             );
+
+		// The loopback server and the benchmark commandlets are development tools, shipping builds leave them out
+		bool bWithTools = Target.Configuration != UnrealTargetConfiguration.Shipping;
+		if (bWithTools)
+		{
+			PrivateDependencyModuleNames.AddRange(new string[] { "HTTPServer", "Projects" });
+		}
+		PrivateDefinitions.Add("WITH_JSON_TOOLS=" + (bWithTools ? "1" : "0"));
 	}
 }
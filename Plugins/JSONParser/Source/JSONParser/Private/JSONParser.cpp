@@ -13,9 +13,38 @@ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 */
 
 #include "JSONParser.h"
+#include "JsonAssets.h"
+#include "JsonParserStats.h"
 
 #define LOCTEXT_NAMESPACE "FJSONParserModule"
 
+DEFINE_STAT(STAT_JsonParse);
+DEFINE_STAT(STAT_JsonSerialize);
+DEFINE_STAT(STAT_JsonEventParse);
+DEFINE_STAT(STAT_JsonBinaryRead);
+DEFINE_STAT(STAT_JsonBinaryWrite);
+DEFINE_STAT(STAT_JsonCompress);
+DEFINE_STAT(STAT_JsonUncompress);
+DEFINE_STAT(STAT_JsonPropertyToJson);
+DEFINE_STAT(STAT_JsonJsonToProperty);
+DEFINE_STAT(STAT_JsonTextureDecode);
+DEFINE_STAT(STAT_JsonTextureEncode);
+DEFINE_STAT(STAT_JsonAsyncRequest);
+DEFINE_STAT(STAT_JsonAsyncResponse);
+DEFINE_STAT(STAT_JsonAsyncFileRead);
+DEFINE_STAT(STAT_JsonAsyncFileWrite);
+DEFINE_STAT(STAT_JsonAsyncCompleted);
+DEFINE_STAT(STAT_JsonWorldCapture);
+DEFINE_STAT(STAT_JsonWorldEncode);
+DEFINE_STAT(STAT_JsonBytesParsed);
+DEFINE_STAT(STAT_JsonBytesWritten);
+DEFINE_STAT(STAT_JsonBytesCompressed);
+
+LLM_DEFINE_TAG(JSONParser);
+
+TRACE_DECLARE_INT_COUNTER(JsonTotalBytesParsed, TEXT("JSONParser/TotalBytesParsed"));
+TRACE_DECLARE_INT_COUNTER(JsonTotalBytesWritten, TEXT("JSONParser/TotalBytesWritten"));
+
 void FJSONParserModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
@@ -25,6 +54,7 @@ void FJSONParserModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	JsonAssets::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,129 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonAssets.h"
+#include "JsonParserStats.h"
+
+#include "Engine/StreamableManager.h"
+#include "UObject/SoftObjectPath.h"
+
+namespace
+{
+	struct FAssetCache
+	{
+		TMap<FString, TWeakObjectPtr<UObject>> Objects;
+
+		/* Size at which the entries of collected objects are dropped */
+		int32 NextPrune = 256;
+
+		FStreamableManager Streamable;
+
+		void Add(const FString& Path, UObject* Object)
+		{
+			if (Objects.Num() >= NextPrune) {
+				for (auto It = Objects.CreateIterator(); It; ++It) {
+					if (!It.Value().IsValid()) {
+						It.RemoveCurrent();
+					}
+				}
+				NextPrune = FMath::Max(256, Objects.Num() * 2);
+			}
+			Objects.Add(Path, Object);
+		}
+	};
+
+	/* Created on first use, the module destroys it on shutdown while the loader is still alive */
+	TUniquePtr<FAssetCache> Cache;
+
+	FAssetCache& GetCache()
+	{
+		check(IsInGameThread());
+		if (!Cache.IsValid()) {
+			Cache = MakeUnique<FAssetCache>();
+		}
+		return *Cache;
+	}
+}
+
+void JsonAssets::Shutdown()
+{
+	// Pending requests are cancelled, their callbacks never run
+	Cache.Reset();
+}
+
+UObject* JsonAssets::FindLoaded(const FString& Path)
+{
+	if (Path.IsEmpty()) {
+		return nullptr;
+	}
+
+	FAssetCache& Cache = GetCache();
+	if (const TWeakObjectPtr<UObject>* Cached = Cache.Objects.Find(Path)) {
+		if (UObject* Object = Cached->Get()) {
+			return Object;
+		}
+	}
+
+	UObject* Object = FSoftObjectPath(Path).ResolveObject();
+	if (Object) {
+		Cache.Add(Path, Object);
+	}
+	return Object;
+}
+
+UObject* JsonAssets::LoadSync(const FString& Path, UClass* Type)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	UObject* Object = FindLoaded(Path);
+	if (!Object && !Path.IsEmpty()) {
+		Object = StaticLoadObject(Type, nullptr, *Path, nullptr, LOAD_None, nullptr);
+		if (Object) {
+			GetCache().Add(Path, Object);
+		}
+	}
+	return Object && Object->IsA(Type) ? Object : nullptr;
+}
+
+void JsonAssets::LoadAsync(const TArray<FString>& Paths, TFunction<void(const TArray<UObject*>&)>&& OnLoaded)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	TArray<UObject*> Objects;
+	Objects.SetNumZeroed(Paths.Num());
+
+	TArray<FSoftObjectPath> ToLoad;
+	for (int32 i = 0; i < Paths.Num(); i++) {
+		Objects[i] = FindLoaded(Paths[i]);
+		if (!Objects[i] && !Paths[i].IsEmpty()) {
+			ToLoad.AddUnique(FSoftObjectPath(Paths[i]));
+		}
+	}
+
+	if (ToLoad.Num() == 0) {
+		OnLoaded(Objects);
+		return;
+	}
+
+	// One request for the whole batch, the loader schedules the packages together
+	GetCache().Streamable.RequestAsyncLoad(MoveTemp(ToLoad), FStreamableDelegate::CreateLambda([Paths, OnLoaded = MoveTemp(OnLoaded)]()
+	{
+		TArray<UObject*> Objects;
+		Objects.Reserve(Paths.Num());
+		for (const FString& Path : Paths) {
+			Objects.Add(FindLoaded(Path));
+		}
+		OnLoaded(Objects);
+	}));
+}
@@ -0,0 +1,44 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+/**
+ * Resolution of the object and class paths held in string fields.
+ * Resolved paths are cached with weak pointers, a path already seen costs one map lookup as long as its object is
+ * loaded. Asynchronous requests batch every path which is not loaded yet into a single streamable request.
+ * Game thread only.
+ */
+namespace JsonAssets
+{
+	/* Cached or already loaded object, null if it still has to be loaded */
+	UObject* FindLoaded(const FString& Path);
+
+	/* Resolve a path, loading it synchronously if needed, null if the path is empty or does not point at a Type */
+	UObject* LoadSync(const FString& Path, UClass* Type);
+
+	/**
+	 * Resolve the paths with one streamable request, OnLoaded gets one object per path, in order, null for the paths
+	 * which failed to load. It runs right away when every path is cached or loaded.
+	 */
+	void LoadAsync(const TArray<FString>& Paths, TFunction<void(const TArray<UObject*>&)>&& OnLoaded);
+
+	/* Releases the cache and its streamable manager, called when the module shuts down */
+	void Shutdown();
+}
@@ -0,0 +1,229 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonBase64.h"
+
+#define JSON_BASE64_SSE (PLATFORM_ALWAYS_HAS_SSE4_1 && !PLATFORM_TCHAR_IS_4_BYTES)
+
+#if JSON_BASE64_SSE
+#include <smmintrin.h>
+#endif
+
+namespace
+{
+	static const ANSICHAR EncodeTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	static const ANSICHAR EncodeTableUrl[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+	/* Value of every character of both alphabets, 0xFF for the characters out of them */
+	struct FDecodeTable
+	{
+		uint8 Values[256];
+
+		FDecodeTable()
+		{
+			FMemory::Memset(Values, 0xFF, sizeof(Values));
+			for (int32 i = 0; i < 64; i++) {
+				Values[uint8(EncodeTable[i])] = uint8(i);
+				Values[uint8(EncodeTableUrl[i])] = uint8(i);
+			}
+		}
+	};
+
+	static const FDecodeTable DecodeTable;
+
+	FORCEINLINE uint32 DecodeChar(TCHAR Char)
+	{
+		return Char < 256 ? DecodeTable.Values[Char] : 0xFF;
+	}
+
+#if JSON_BASE64_SSE
+	/**
+	 * Decode 16 standard characters to 12 bytes, 16 bytes are stored. Returns false when a character is out of the
+	 * standard alphabet, the block is left to the scalar loop which handles the URL alphabet and reports errors.
+	 */
+	FORCEINLINE bool DecodeBlock(const TCHAR* Chars, uint8* Out)
+	{
+		// Characters above 0xFF saturate to 0xFF, which is out of every range below
+		const __m128i Input = _mm_packus_epi16(
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(Chars)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(Chars + 8)));
+
+		const auto InRange = [&Input](char Low, char High)
+		{
+			return _mm_and_si128(_mm_cmpgt_epi8(Input, _mm_set1_epi8(Low - 1)), _mm_cmplt_epi8(Input, _mm_set1_epi8(High + 1)));
+		};
+		const __m128i Upper = InRange('A', 'Z');
+		const __m128i Lower = InRange('a', 'z');
+		const __m128i Digit = InRange('0', '9');
+		const __m128i Plus = _mm_cmpeq_epi8(Input, _mm_set1_epi8('+'));
+		const __m128i Slash = _mm_cmpeq_epi8(Input, _mm_set1_epi8('/'));
+
+		const __m128i Valid = _mm_or_si128(_mm_or_si128(Upper, Lower), _mm_or_si128(Digit, _mm_or_si128(Plus, Slash)));
+		if (_mm_movemask_epi8(Valid) != 0xFFFF) {
+			return false;
+		}
+
+		// Offset from the character to its 6-bit value, per range
+		__m128i Shift = _mm_and_si128(Upper, _mm_set1_epi8(-'A'));
+		Shift = _mm_or_si128(Shift, _mm_and_si128(Lower, _mm_set1_epi8(26 - 'a')));
+		Shift = _mm_or_si128(Shift, _mm_and_si128(Digit, _mm_set1_epi8(52 - '0')));
+		Shift = _mm_or_si128(Shift, _mm_and_si128(Plus, _mm_set1_epi8(62 - '+')));
+		Shift = _mm_or_si128(Shift, _mm_and_si128(Slash, _mm_set1_epi8(63 - '/')));
+		const __m128i Values = _mm_add_epi8(Input, Shift);
+
+		// Merge the 6-bit values into 24-bit groups, then keep the 3 bytes of each group in big endian order
+		const __m128i Pairs = _mm_maddubs_epi16(Values, _mm_set1_epi32(0x01400140));
+		const __m128i Groups = _mm_madd_epi16(Pairs, _mm_set1_epi32(0x00011000));
+		const __m128i Bytes = _mm_shuffle_epi8(Groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), Bytes);
+		return true;
+	}
+
+	/* Encode 12 bytes to 16 characters, 16 bytes are read */
+	FORCEINLINE void EncodeBlock(const uint8* Data, TCHAR* Chars, const __m128i& ShiftTable)
+	{
+		// Spread the 12 bytes to 4 lanes of 3, then move each 6-bit value to its own byte
+		__m128i Input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data));
+		Input = _mm_shuffle_epi8(Input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+		const __m128i High = _mm_mulhi_epu16(_mm_and_si128(Input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+		const __m128i Low = _mm_mullo_epi16(_mm_and_si128(Input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+		const __m128i Values = _mm_or_si128(High, Low);
+
+		// Range of each value: 13 for A-Z, 0 for a-z, 1 to 10 for the digits, 11 for 62 and 12 for 63
+		__m128i Range = _mm_subs_epu8(Values, _mm_set1_epi8(51));
+		Range = _mm_or_si128(Range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), Values), _mm_set1_epi8(13)));
+		const __m128i Ascii = _mm_add_epi8(Values, _mm_shuffle_epi8(ShiftTable, Range));
+
+		const __m128i Zero = _mm_setzero_si128();
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Chars), _mm_unpacklo_epi8(Ascii, Zero));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Chars + 8), _mm_unpackhi_epi8(Ascii, Zero));
+	}
+#endif
+}
+
+bool JsonBase64::Decode(FStringView Source, TArray<uint8>& OutData)
+{
+	const TCHAR* Chars = Source.GetData();
+	int32 Length = Source.Len();
+	while (Length > 0 && Chars[Length - 1] == TEXT('=')) {
+		Length--;
+	}
+
+	// A single character left over cannot hold a byte
+	if (Length % 4 == 1) {
+		return false;
+	}
+
+	const int32 Size = Length / 4 * 3 + FMath::Max(Length % 4 - 1, 0);
+	OutData.SetNumUninitialized(Size);
+	uint8* Out = OutData.GetData();
+
+	const TCHAR* Char = Chars;
+	const TCHAR* QuadEnd = Chars + (Length & ~3);
+
+#if JSON_BASE64_SSE
+	// Each block stores 16 bytes for 12 decoded, the last blocks are left to the scalar loop
+	const uint8* OutEnd = OutData.GetData() + Size;
+	while (QuadEnd - Char >= 16 && OutEnd - Out >= 16 && DecodeBlock(Char, Out)) {
+		Char += 16;
+		Out += 12;
+	}
+#endif
+
+	// Whole quads, the invalid bit (0xFF) of any character survives the OR and is checked once per quad
+	for (; Char < QuadEnd; Char += 4) {
+		const uint32 A = DecodeChar(Char[0]);
+		const uint32 B = DecodeChar(Char[1]);
+		const uint32 C = DecodeChar(Char[2]);
+		const uint32 D = DecodeChar(Char[3]);
+		if ((A | B | C | D) & 0x80) {
+			return false;
+		}
+
+		const uint32 Bits = (A << 18) | (B << 12) | (C << 6) | D;
+		Out[0] = uint8(Bits >> 16);
+		Out[1] = uint8(Bits >> 8);
+		Out[2] = uint8(Bits);
+		Out += 3;
+	}
+
+	// Tail of 2 or 3 characters
+	const int32 Tail = Length & 3;
+	if (Tail) {
+		const uint32 A = DecodeChar(Char[0]);
+		const uint32 B = DecodeChar(Char[1]);
+		const uint32 C = Tail == 3 ? DecodeChar(Char[2]) : 0;
+		if ((A | B | C) & 0x80) {
+			return false;
+		}
+
+		const uint32 Bits = (A << 18) | (B << 12) | (C << 6);
+		*Out++ = uint8(Bits >> 16);
+		if (Tail == 3) {
+			*Out++ = uint8(Bits >> 8);
+		}
+	}
+	return true;
+}
+
+void JsonBase64::Encode(const uint8* Data, int32 Size, FString& Out, bool bUrlSafe)
+{
+	const ANSICHAR* Table = bUrlSafe ? EncodeTableUrl : EncodeTable;
+	const int32 Start = Out.Len();
+	const int32 Length = GetEncodedLength(Size, !bUrlSafe);
+	Out.GetCharArray().SetNumUninitialized(Start + Length + 1);
+	TCHAR* Char = Out.GetCharArray().GetData() + Start;
+
+	const uint8* End = Data + Size - Size % 3;
+
+#if JSON_BASE64_SSE
+	// Offset from each range to its character, see EncodeBlock
+	const __m128i ShiftTable = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, Table[62] - 62, Table[63] - 63, 'A', 0, 0);
+
+	// Each block reads 16 bytes for 12 encoded
+	for (; End - Data >= 16; Data += 12) {
+		EncodeBlock(Data, Char, ShiftTable);
+		Char += 16;
+	}
+#endif
+
+	for (; Data < End; Data += 3) {
+		const uint32 Bits = (uint32(Data[0]) << 16) | (uint32(Data[1]) << 8) | Data[2];
+		Char[0] = Table[(Bits >> 18) & 63];
+		Char[1] = Table[(Bits >> 12) & 63];
+		Char[2] = Table[(Bits >> 6) & 63];
+		Char[3] = Table[Bits & 63];
+		Char += 4;
+	}
+
+	const int32 Tail = Size % 3;
+	if (Tail) {
+		const uint32 Bits = (uint32(Data[0]) << 16) | (Tail == 2 ? uint32(Data[1]) << 8 : 0);
+		*Char++ = Table[(Bits >> 18) & 63];
+		*Char++ = Table[(Bits >> 12) & 63];
+		if (Tail == 2) {
+			*Char++ = Table[(Bits >> 6) & 63];
+		}
+		else if (!bUrlSafe) {
+			*Char++ = TEXT('=');
+		}
+		if (!bUrlSafe) {
+			*Char++ = TEXT('=');
+		}
+	}
+	*Char = TEXT('\0');
+}
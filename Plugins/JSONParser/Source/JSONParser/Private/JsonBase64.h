@@ -0,0 +1,38 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace JsonBase64
+{
+	/* Exact size of the encoding of Size bytes, padding included */
+	inline int32 GetEncodedLength(int32 Size, bool bPad = true)
+	{
+		return bPad ? ((Size + 2) / 3) * 4 : (Size * 4 + 2) / 3;
+	}
+
+	/**
+	 * Decode base64 straight from the characters of a field, without the intermediate string FBase64 builds.
+	 * Both the standard and the URL alphabets are accepted and padding is optional, any other character fails
+	 * the decode. Blocks of 16 characters go through SSE4.1 when the target always has it.
+	 */
+	bool Decode(FStringView Source, TArray<uint8>& OutData);
+
+	/* Encode with the standard alphabet and padding, or with the unpadded URL alphabet, appended to Out */
+	void Encode(const uint8* Data, int32 Size, FString& Out, bool bUrlSafe = false);
+}
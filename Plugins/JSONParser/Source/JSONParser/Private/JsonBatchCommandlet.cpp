@@ -0,0 +1,394 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonBatchCommandlet.h"
+
+#include "JsonBinary.h"
+#include "JsonFieldData.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+UJsonBatchCommandlet::UJsonBatchCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+namespace JsonBatch
+{
+	enum class ECommand
+	{
+		Validate,
+		Minify,
+		Prettify,
+		Compress,
+		Decompress,
+		ToBinary,
+		Merge,
+	};
+
+	struct FFileResult
+	{
+		FString Filename;
+		FString Error;
+		bool bSuccess = false;
+		int64 InBytes = 0;
+		int64 OutBytes = 0;
+		double ReadTime = 0.0;
+		double ProcessTime = 0.0;
+		double WriteTime = 0.0;
+	};
+
+	static bool ParseCommand(const TArray<FString>& Tokens, ECommand& OutCommand)
+	{
+		static const TPair<const TCHAR*, ECommand> Commands[] = {
+			{ TEXT("validate"), ECommand::Validate },
+			{ TEXT("minify"), ECommand::Minify },
+			{ TEXT("prettify"), ECommand::Prettify },
+			{ TEXT("compress"), ECommand::Compress },
+			{ TEXT("decompress"), ECommand::Decompress },
+			{ TEXT("tobinary"), ECommand::ToBinary },
+			{ TEXT("merge"), ECommand::Merge },
+		};
+
+		for (const FString& Token : Tokens) {
+			for (const auto& Command : Commands) {
+				if (Token.Equals(Command.Key, ESearchCase::IgnoreCase)) {
+					OutCommand = Command.Value;
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	/* Expands the '+' separated list of files and wildcards, sorted and without duplicates */
+	static TArray<FString> FindFiles(const FString& Patterns, bool bRecursive)
+	{
+		TArray<FString> Patternlist;
+		Patterns.ParseIntoArray(Patternlist, TEXT("+"), true);
+
+		TSet<FString> Unique;
+		for (const FString& Pattern : Patternlist)
+		{
+			const FString Directory = FPaths::GetPath(Pattern);
+			const FString Wildcard = FPaths::GetCleanFilename(Pattern);
+
+			TArray<FString> Found;
+			if (bRecursive) {
+				IFileManager::Get().FindFilesRecursive(Found, *Directory, *Wildcard, true, false);
+			}
+			else {
+				IFileManager::Get().FindFiles(Found, *Pattern, true, false);
+				for (FString& File : Found) {
+					File = FPaths::Combine(Directory, File);
+				}
+			}
+
+			for (FString& File : Found) {
+				FPaths::NormalizeFilename(File);
+				Unique.Add(FPaths::ConvertRelativePathToFull(File));
+			}
+		}
+
+		TArray<FString> Files = Unique.Array();
+		Files.Sort();
+		return Files;
+	}
+
+	/* Loads a document, the format is chosen from the extension (.jsonz archive, .jsonb binary, text otherwise) */
+	static bool LoadDocument(const FString& Filename, TSharedPtr<FJsonObject>& OutObject, FFileResult& Result)
+	{
+		double Start = FPlatformTime::Seconds();
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *Filename)) {
+			Result.Error = TEXT("unable to read the file");
+			return false;
+		}
+		Result.InBytes = Bytes.Num();
+		Result.ReadTime = FPlatformTime::Seconds() - Start;
+
+		Start = FPlatformTime::Seconds();
+		const FString Extension = FPaths::GetExtension(Filename);
+		bool bLoaded = false;
+		if (Extension.Equals(TEXT("jsonb"), ESearchCase::IgnoreCase)) {
+			bLoaded = FJsonBinary::Read(Bytes, OutObject);
+		}
+		else {
+			FString Text;
+			if (Extension.Equals(TEXT("jsonz"), ESearchCase::IgnoreCase)) {
+				if (!UJsonFieldData::UncompressString(Bytes, Text)) {
+					Result.Error = TEXT("invalid archive");
+					return false;
+				}
+			}
+			else {
+				FFileHelper::BufferToString(Text, Bytes.GetData(), Bytes.Num());
+			}
+			bLoaded = UJsonFieldData::DeserializeObject(Text, OutObject);
+		}
+		Result.ProcessTime += FPlatformTime::Seconds() - Start;
+
+		if (!bLoaded) {
+			Result.Error = TEXT("invalid JSON");
+		}
+		return bLoaded;
+	}
+
+	/* Saves a document, the format is chosen from the extension like LoadDocument */
+	static bool SaveDocument(const FString& Filename, const TSharedPtr<FJsonObject>& Object, bool bPretty, FFileResult& Result)
+	{
+		double Start = FPlatformTime::Seconds();
+		const FString Extension = FPaths::GetExtension(Filename);
+		TArray<uint8> Bytes;
+		if (Extension.Equals(TEXT("jsonb"), ESearchCase::IgnoreCase)) {
+			FJsonBinary::Write(Object, Bytes);
+		}
+		else if (Extension.Equals(TEXT("jsonz"), ESearchCase::IgnoreCase)) {
+			if (!UJsonFieldData::CompressString(UJsonFieldData::SerializeObject(Object, false), Bytes)) {
+				Result.Error = TEXT("compression failed");
+				return false;
+			}
+		}
+		else {
+			bool bComplete = true;
+			const FString Text = UJsonFieldData::SerializeObject(Object, bPretty, -1, &bComplete);
+			if (!bComplete) {
+				Result.Error = TEXT("nested too deep");
+				return false;
+			}
+			FTCHARToUTF8 Utf8(*Text, Text.Len());
+			Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		}
+		Result.ProcessTime += FPlatformTime::Seconds() - Start;
+
+		Start = FPlatformTime::Seconds();
+		if (!FFileHelper::SaveArrayToFile(Bytes, *Filename)) {
+			Result.Error = TEXT("unable to write ") + Filename;
+			return false;
+		}
+		Result.OutBytes = Bytes.Num();
+		Result.WriteTime = FPlatformTime::Seconds() - Start;
+		return true;
+	}
+
+	static FString GetOutputFilename(const FString& Filename, const FString& OutDir, const TCHAR* NewExtension)
+	{
+		FString Output = OutDir.IsEmpty() ? Filename : FPaths::Combine(OutDir, FPaths::GetCleanFilename(Filename));
+		if (NewExtension) {
+			Output = FPaths::ChangeExtension(Output, NewExtension);
+		}
+		return Output;
+	}
+
+	static void ProcessFile(ECommand Command, const FString& OutDir, bool bInPlace, FFileResult& Result)
+	{
+		TSharedPtr<FJsonObject> Object;
+		if (!LoadDocument(Result.Filename, Object, Result)) {
+			return;
+		}
+
+		FString Output;
+		bool bPretty = false;
+		switch (Command)
+		{
+		case ECommand::Validate:
+			Result.bSuccess = true;
+			return;
+		case ECommand::Minify:
+			Output = GetOutputFilename(Result.Filename, OutDir, nullptr);
+			break;
+		case ECommand::Prettify:
+			Output = GetOutputFilename(Result.Filename, OutDir, nullptr);
+			bPretty = true;
+			break;
+		case ECommand::Compress:
+			Output = GetOutputFilename(Result.Filename, OutDir, TEXT("jsonz"));
+			break;
+		case ECommand::ToBinary:
+			Output = GetOutputFilename(Result.Filename, OutDir, TEXT("jsonb"));
+			break;
+		case ECommand::Decompress:
+			Output = GetOutputFilename(Result.Filename, OutDir, TEXT("json"));
+			bPretty = true;
+			break;
+		default:
+			return;
+		}
+
+		// A source is only replaced on request
+		if (!bInPlace && FPaths::IsSamePath(Output, Result.Filename)) {
+			Result.Error = TEXT("would overwrite the source, use -Out=<dir> or -InPlace");
+			return;
+		}
+		Result.bSuccess = SaveDocument(Output, Object, bPretty, Result);
+	}
+
+	/* Copies Source into Target, nested objects are merged and everything else is replaced */
+	static void DeepMerge(const TSharedPtr<FJsonObject>& Target, const TSharedPtr<FJsonObject>& Source)
+	{
+		for (const auto& Pair : Source->Values)
+		{
+			const TSharedPtr<FJsonValue>* Existing = Target->Values.Find(Pair.Key);
+			if (Existing && (*Existing)->Type == EJson::Object && Pair.Value->Type == EJson::Object) {
+				DeepMerge((*Existing)->AsObject(), Pair.Value->AsObject());
+			}
+			else {
+				Target->SetField(Pair.Key, Pair.Value);
+			}
+		}
+	}
+
+	/**
+	* Runs Body for every index with at most NumWorkers tasks in flight, each task handling one file at a time
+	* so the memory in use is bounded by the number of workers and not by the number of files.
+	*/
+	static void ForEachBounded(int32 Num, int32 NumWorkers, TFunctionRef<void(int32)> Body)
+	{
+		TAtomic<int32> Next(0);
+		ParallelFor(FMath::Min(NumWorkers, Num), [&](int32)
+		{
+			for (int32 Index = Next++; Index < Num; Index = Next++) {
+				Body(Index);
+			}
+		}, NumWorkers <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+	}
+}
+
+/**
+* Runs the requested command over every matching file
+*
+* @param	Params		Command line
+*
+* @return	0 when every file was processed
+*/
+int32 UJsonBatchCommandlet::Main(const FString& Params)
+{
+	using namespace JsonBatch;
+
+	TArray<FString> Tokens, Switches;
+	ParseCommandLine(*Params, Tokens, Switches);
+
+	ECommand Command;
+	FString Patterns;
+	if (!ParseCommand(Tokens, Command) || !FParse::Value(*Params, TEXT("Files="), Patterns, false)) {
+		UE_LOG(LogJson, Error, TEXT("Usage: -run=JsonBatch <validate|minify|prettify|compress|decompress|tobinary|merge> -Files=<dir/*.json>[+...] [-Recursive] [-Out=<dir>|-InPlace] [-Output=<file>] [-Threads=N]"));
+		return 1;
+	}
+
+	FString OutDir, MergeOutput;
+	int32 NumWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	FParse::Value(*Params, TEXT("Out="), OutDir, false);
+	FParse::Value(*Params, TEXT("Output="), MergeOutput, false);
+	FParse::Value(*Params, TEXT("Threads="), NumWorkers);
+	NumWorkers = FMath::Max(NumWorkers, 1);
+
+	if (Command == ECommand::Merge && MergeOutput.IsEmpty()) {
+		UE_LOG(LogJson, Error, TEXT("merge requires -Output=<file>"));
+		return 1;
+	}
+	const bool bInPlace = FParse::Param(*Params, TEXT("InPlace"));
+	if ((Command == ECommand::Minify || Command == ECommand::Prettify) && OutDir.IsEmpty() && !bInPlace) {
+		UE_LOG(LogJson, Error, TEXT("minify and prettify rewrite their sources without -Out=<dir>, pass -InPlace to allow it"));
+		return 1;
+	}
+	if (!OutDir.IsEmpty() && !IFileManager::Get().MakeDirectory(*OutDir, true)) {
+		UE_LOG(LogJson, Error, TEXT("Unable to create the output directory %s"), *OutDir);
+		return 1;
+	}
+
+	const TArray<FString> Files = FindFiles(Patterns, FParse::Param(*Params, TEXT("Recursive")));
+	if (Files.Num() == 0) {
+		UE_LOG(LogJson, Warning, TEXT("No file matches %s"), *Patterns);
+		return 0;
+	}
+
+	TArray<FFileResult> Results;
+	Results.SetNum(Files.Num());
+	for (int32 i = 0; i < Files.Num(); i++) {
+		Results[i].Filename = Files[i];
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (Command == ECommand::Merge)
+	{
+		// Parse one batch in parallel, fold it in order, then release it before the next batch
+		TSharedPtr<FJsonObject> Merged = MakeShared<FJsonObject>();
+		for (int32 BatchStart = 0; BatchStart < Files.Num(); BatchStart += NumWorkers)
+		{
+			const int32 BatchSize = FMath::Min(NumWorkers, Files.Num() - BatchStart);
+			TArray<TSharedPtr<FJsonObject>> Batch;
+			Batch.SetNum(BatchSize);
+
+			ForEachBounded(BatchSize, NumWorkers, [&](int32 i)
+			{
+				FFileResult& Result = Results[BatchStart + i];
+				Result.bSuccess = LoadDocument(Result.Filename, Batch[i], Result);
+			});
+
+			for (int32 i = 0; i < BatchSize; i++) {
+				if (Batch[i].IsValid()) {
+					const double Start = FPlatformTime::Seconds();
+					DeepMerge(Merged, Batch[i]);
+					Results[BatchStart + i].ProcessTime += FPlatformTime::Seconds() - Start;
+				}
+			}
+		}
+
+		FFileResult OutputResult;
+		if (!SaveDocument(MergeOutput, Merged, true, OutputResult)) {
+			UE_LOG(LogJson, Error, TEXT("merge: %s"), *OutputResult.Error);
+			return 1;
+		}
+		UE_LOG(LogJson, Display, TEXT("Merged %d files into %s (%.1f KB)"), Files.Num(), *MergeOutput, OutputResult.OutBytes / 1024.0);
+	}
+	else
+	{
+		ForEachBounded(Files.Num(), NumWorkers, [&](int32 i)
+		{
+			ProcessFile(Command, OutDir, bInPlace, Results[i]);
+		});
+	}
+
+	const double WallTime = FPlatformTime::Seconds() - StartTime;
+
+	int32 NumFailed = 0;
+	int64 TotalIn = 0, TotalOut = 0;
+	for (const FFileResult& Result : Results)
+	{
+		TotalIn += Result.InBytes;
+		TotalOut += Result.OutBytes;
+		if (Result.bSuccess) {
+			UE_LOG(LogJson, Display, TEXT("  [ OK ] %s  read %.2fms  process %.2fms  write %.2fms  %.1f KB -> %.1f KB"),
+				*Result.Filename, Result.ReadTime * 1000.0, Result.ProcessTime * 1000.0, Result.WriteTime * 1000.0, Result.InBytes / 1024.0, Result.OutBytes / 1024.0);
+		}
+		else {
+			++NumFailed;
+			UE_LOG(LogJson, Error, TEXT("  [FAIL] %s  %s"), *Result.Filename, *Result.Error);
+		}
+	}
+
+	UE_LOG(LogJson, Display, TEXT("%d files, %d failed, %.1f MB in, %.1f MB out, %.2fs on %d workers"),
+		Files.Num(), NumFailed, TotalIn / (1024.0 * 1024.0), TotalOut / (1024.0 * 1024.0), WallTime, NumWorkers);
+
+	return NumFailed == 0 ? 0 : 1;
+}
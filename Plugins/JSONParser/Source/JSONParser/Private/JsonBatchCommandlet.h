@@ -0,0 +1,49 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "JsonBatchCommandlet.generated.h"
+
+/**
+* Processes JSON data files offline, in parallel across all the worker threads.
+*
+* UnrealEditor-Cmd <Project> -run=JsonBatch -nullrhi <Command> -Files=<dir/*.json>[+<dir2/*.json>] [-Recursive] [-Out=<dir>|-InPlace] [-Threads=N]
+*
+* Commands:
+*   validate      Parse every file and report the invalid ones
+*   minify        Rewrite the files condensed
+*   prettify      Rewrite the files pretty printed
+*   compress      Convert to the archive format (.jsonz)
+*   decompress    Convert from the archive or the compact binary format to text (.json)
+*   tobinary      Convert to the compact binary format (.jsonb)
+*   merge         Deep merge every file, in order, into -Output=<file>
+*
+* Without -Out, results are written next to their source. A source is never replaced without -InPlace.
+*/
+UCLASS()
+class UJsonBatchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UJsonBatchCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,449 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonBenchmarkCommandlet.h"
+
+#include "JsonFieldData.h"
+#include "JsonRecordArray.h"
+#include "HAL/PlatformMemory.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+UJsonBenchmarkCommandlet::UJsonBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+#if WITH_JSON_TOOLS
+namespace JsonBenchmark
+{
+	struct FResult
+	{
+		FString Name;
+
+		/* Median time of one iteration */
+		double Seconds = 0.0;
+
+		/* Bytes of JSON text read or written by one iteration */
+		int64 Bytes = 0;
+
+		/* Heap blocks the produced document is made of, counted from its nodes rather than measured (see CountTreeBlocks) */
+		int64 TreeBlocks = 0;
+
+		/* Growth of the process resident memory while the case ran, not a heap peak */
+		int64 ResidentGrowth = 0;
+
+		double MBps() const
+		{
+			return Seconds > 0.0 ? (Bytes / (1024.0 * 1024.0)) / Seconds : 0.0;
+		}
+	};
+
+	/**
+	* Estimates the heap blocks of a document from its nodes: one per object, value, key and non-empty string.
+	* A record array counts its value block, and its shape once (object, key array, key map and keys).
+	* Nothing is hooked into the allocator, the temporary allocations of the parser are not part of the count.
+	*/
+	static int64 CountTreeBlocks(const TSharedPtr<FJsonObject>& Root)
+	{
+		int64 Count = 0;
+		TArray<const FJsonValue*> Stack;
+		TArray<const FJsonObject*> Objects;
+		TSet<const FJsonShape*> Shapes;
+		if (Root.IsValid()) {
+			Objects.Add(Root.Get());
+		}
+
+		while (Objects.Num() || Stack.Num())
+		{
+			if (Objects.Num()) {
+				const FJsonObject* Object = Objects.Pop(false);
+				Count += 2; // object and its map storage
+				for (const auto& Pair : Object->Values) {
+					Count += Pair.Key.IsEmpty() ? 0 : 1;
+					Stack.Add(Pair.Value.Get());
+				}
+				continue;
+			}
+
+			const FJsonValue* Value = Stack.Pop(false);
+			if (!Value) {
+				continue;
+			}
+			++Count;
+
+			switch (Value->Type)
+			{
+			case EJson::String:
+				Count += Value->AsString().IsEmpty() ? 0 : 1;
+				break;
+			case EJson::Array:
+			{
+				Count += 1;
+				// Record arrays hold their values in one block and share their keys, walk them without building the records
+				const FJsonValueRecordArray* Records = FJsonValueRecordArray::Cast(*Value);
+				const TSharedPtr<const FJsonValueRecordArray::FSlots> Flat = Records ? Records->PinSlots() : nullptr;
+				if (Flat.IsValid()) {
+					const FJsonShape& Shape = Records->GetShape();
+					bool bShapeCounted = false;
+					Shapes.Add(&Shape, &bShapeCounted);
+					Count += 1 + (bShapeCounted ? 0 : 3 + Shape.Num());
+					for (const TSharedPtr<FJsonValue>& Slot : *Flat) {
+						Stack.Add(Slot.Get());
+					}
+					break;
+				}
+				for (const TSharedPtr<FJsonValue>& Item : Value->AsArray()) {
+					Stack.Add(Item.Get());
+				}
+				break;
+			}
+			case EJson::Object:
+				Objects.Add(Value->AsObject().Get());
+				break;
+			default:
+				break;
+			}
+		}
+
+		return Count;
+	}
+
+	static int64 GetUsedPhysical()
+	{
+		return (int64)FPlatformMemory::GetStats().UsedPhysical;
+	}
+
+	/**
+	* Runs Body until MinTime elapsed (at least 3 iterations) and keeps the median time
+	*/
+	static FResult Measure(const FString& Name, int64 Bytes, double MinTime, TFunctionRef<void()> Body)
+	{
+		FResult Result;
+		Result.Name = Name;
+		Result.Bytes = Bytes;
+
+		const int64 MemoryBefore = GetUsedPhysical();
+		int64 MemoryPeak = MemoryBefore;
+
+		// Warm up caches and allocator pools
+		Body();
+
+		TArray<double> Times;
+		const double Start = FPlatformTime::Seconds();
+		while (Times.Num() < 3 || (FPlatformTime::Seconds() - Start < MinTime && Times.Num() < 1000))
+		{
+			const double IterationStart = FPlatformTime::Seconds();
+			Body();
+			Times.Add(FPlatformTime::Seconds() - IterationStart);
+			MemoryPeak = FMath::Max(MemoryPeak, GetUsedPhysical());
+		}
+
+		Times.Sort();
+		Result.Seconds = Times[Times.Num() / 2];
+		Result.ResidentGrowth = FMath::Max<int64>(0, MemoryPeak - MemoryBefore);
+		return Result;
+	}
+
+	/* A document nested Depth times: {"a":[{"a":[ ... ]}]} */
+	static FString MakeDeepDocument(int32 Depth)
+	{
+		FString Text;
+		Text.Reserve(Depth * 12);
+		for (int32 i = 0; i < Depth; i++) {
+			Text += TEXT("{\"level\":");
+			Text.AppendInt(i);
+			Text += TEXT(",\"child\":[");
+		}
+		Text += TEXT("{}");
+		for (int32 i = 0; i < Depth; i++) {
+			Text += TEXT("]}");
+		}
+		return Text;
+	}
+
+	/* A single object with Width keys of mixed types */
+	static FString MakeWideDocument(int32 Width)
+	{
+		FString Text;
+		Text.Reserve(Width * 24);
+		Text += TEXT("{");
+		for (int32 i = 0; i < Width; i++) {
+			if (i > 0) {
+				Text += TEXT(",");
+			}
+			switch (i % 4)
+			{
+			case 0: Text += FString::Printf(TEXT("\"key_%d\":%d"), i, i); break;
+			case 1: Text += FString::Printf(TEXT("\"key_%d\":%.4f"), i, i * 0.001); break;
+			case 2: Text += FString::Printf(TEXT("\"key_%d\":\"value_%d\""), i, i); break;
+			default: Text += FString::Printf(TEXT("\"key_%d\":%s"), i, (i & 1) ? TEXT("true") : TEXT("false")); break;
+			}
+		}
+		Text += TEXT("}");
+		return Text;
+	}
+
+	/* A document holding one large array per typed getter */
+	static UJsonFieldData* MakeArraysDocument(int32 Count)
+	{
+		TArray<float> Numbers;
+		TArray<FString> Strings;
+		TArray<FName> Names;
+		TArray<bool> Bools;
+		TArray<uint8> Bytes;
+		TArray<UJsonFieldData*> Objects;
+
+		UJsonFieldData* Document = NewObject<UJsonFieldData>();
+		for (int32 i = 0; i < Count; i++) {
+			Numbers.Add(i * 0.5f);
+			Strings.Add(FString::Printf(TEXT("string_%d"), i));
+			Names.Add(FName(TEXT("name"), i % 64));
+			Bools.Add((i & 1) == 0);
+			Bytes.Add(i & 0xFF);
+		}
+		for (int32 i = 0; i < Count / 10; i++) {
+			UJsonFieldData* Item = NewObject<UJsonFieldData>(Document);
+			Item->SetNumber(TEXT("id"), i);
+			Item->SetString(TEXT("name"), Strings[i]);
+			Objects.Add(Item);
+		}
+
+		return Document->SetNumberArray(TEXT("numbers"), Numbers)
+			->SetStringArray(TEXT("strings"), Strings)
+			->SetNameArray(TEXT("names"), Names)
+			->SetBoolArray(TEXT("bools"), Bools)
+			->SetByteArray(TEXT("bytes"), Bytes)
+			->SetObjectArray(TEXT("objects"), Objects);
+	}
+
+	static UJsonBenchmarkRecord* MakeRecord(int32 Seed)
+	{
+		UJsonBenchmarkRecord* Record = NewObject<UJsonBenchmarkRecord>();
+		Record->Level = Seed;
+		Record->Health = Seed * 1.5f;
+		Record->DisplayName = FString::Printf(TEXT("Record %d"), Seed);
+		Record->Location = FVector(Seed, -Seed, Seed * 2.0);
+		for (int32 i = 0; i < 64; i++) {
+			Record->Samples.Add(FMath::Sin(i + Seed));
+			Record->Path.Add(FVector(i, i * 2.0, i * 3.0));
+			Record->Counters.Add(FString::Printf(TEXT("counter_%d"), i), i * Seed);
+		}
+		return Record;
+	}
+}
+
+/**
+* Runs every benchmark case, prints a report and checks it against the baseline
+*
+* @param	Params		Command line
+*
+* @return	0 when no regression was detected
+*/
+int32 UJsonBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace JsonBenchmark;
+
+	FString CorpusDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("Benchmarks"));
+	// The baseline is versioned with the plugin, Saved is not
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("JSONParser"));
+	FString BaselineFile = FPaths::Combine(Plugin.IsValid() ? Plugin->GetBaseDir() : FPaths::ProjectPluginsDir() / TEXT("JSONParser"), TEXT("Benchmarks"), TEXT("BenchmarkBaseline.json"));
+	float Tolerance = 0.15f;
+	double MinTime = 0.5;
+
+	FParse::Value(*Params, TEXT("Corpus="), CorpusDir);
+	FParse::Value(*Params, TEXT("Baseline="), BaselineFile);
+	FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+	FParse::Value(*Params, TEXT("MinTime="), MinTime);
+	const bool bWriteBaseline = FParse::Param(*Params, TEXT("WriteBaseline"));
+	const bool bRequireBaseline = GIsBuildMachine || FParse::Param(*Params, TEXT("CI"));
+
+	// Standard corpora are not shipped with the plugin, missing files are skipped
+	TArray<TPair<FString, FString>> Inputs;
+	for (const TCHAR* CorpusName : { TEXT("twitter"), TEXT("canada"), TEXT("citm_catalog") })
+	{
+		FString Text;
+		const FString Filename = FPaths::Combine(CorpusDir, FString(CorpusName) + TEXT(".json"));
+		if (FFileHelper::LoadFileToString(Text, *Filename)) {
+			Inputs.Emplace(CorpusName, MoveTemp(Text));
+		}
+		else {
+			UE_LOG(LogJson, Warning, TEXT("Benchmark corpus '%s' not found, skipped"), *Filename);
+		}
+	}
+	Inputs.Emplace(TEXT("synthetic_deep"), MakeDeepDocument(5000));
+	Inputs.Emplace(TEXT("synthetic_wide"), MakeWideDocument(100000));
+
+	TArray<FResult> Results;
+
+	for (const TPair<FString, FString>& Input : Inputs)
+	{
+		const FString& Name = Input.Key;
+		const FString& Text = Input.Value;
+		const int64 TextBytes = FTCHARToUTF8(*Text).Length();
+
+		UJsonFieldData* Document = NewObject<UJsonFieldData>();
+		Document->AddToRoot();
+
+		Results.Add(Measure(Name + TEXT(".FromString"), TextBytes, MinTime, [&]() { Document->FromString(Text); }));
+		Results.Last().TreeBlocks = CountTreeBlocks(Document->Data);
+
+		const FString Condensed = Document->GetContentString();
+		Results.Add(Measure(Name + TEXT(".GetContentString"), FTCHARToUTF8(*Condensed).Length(), MinTime, [&]() { Document->GetContentString(); }));
+
+		const FString Pretty = Document->GetPrettyString();
+		Results.Add(Measure(Name + TEXT(".GetPrettyString"), FTCHARToUTF8(*Pretty).Length(), MinTime, [&]() { Document->GetPrettyString(); }));
+
+		TArray<uint8> Compressed;
+		bool bIsValid = false;
+		Results.Add(Measure(Name + TEXT(".GetContentCompressed"), TextBytes, MinTime, [&]() { Document->GetContentCompressed(Compressed, bIsValid); }));
+
+		UJsonFieldData* Decompressed = NewObject<UJsonFieldData>();
+		Decompressed->AddToRoot();
+		Results.Add(Measure(Name + TEXT(".FromCompressed"), TextBytes, MinTime, [&]() { Decompressed->FromCompressed(Compressed, bIsValid); }));
+		Results.Last().TreeBlocks = CountTreeBlocks(Decompressed->Data);
+
+		Decompressed->RemoveFromRoot();
+		Document->RemoveFromRoot();
+	}
+
+	// Typed array getters
+	{
+		UJsonFieldData* Arrays = MakeArraysDocument(100000);
+		Arrays->AddToRoot();
+		const int64 ArrayBytes = FTCHARToUTF8(*Arrays->GetContentString()).Length();
+
+		Results.Add(Measure(TEXT("arrays.GetNumberArray"), ArrayBytes, MinTime, [&]() { Arrays->GetNumberArray(TEXT("numbers")); }));
+		Results.Add(Measure(TEXT("arrays.GetStringArray"), ArrayBytes, MinTime, [&]() { Arrays->GetStringArray(TEXT("strings")); }));
+		Results.Add(Measure(TEXT("arrays.GetNameArray"), ArrayBytes, MinTime, [&]() { Arrays->GetNameArray(TEXT("names")); }));
+		Results.Add(Measure(TEXT("arrays.GetBoolArray"), ArrayBytes, MinTime, [&]() { Arrays->GetBoolArray(TEXT("bools")); }));
+		Results.Add(Measure(TEXT("arrays.GetByteArray"), ArrayBytes, MinTime, [&]() { Arrays->GetByteArray(TEXT("bytes")); }));
+		Results.Add(Measure(TEXT("arrays.GetObjectArray"), ArrayBytes, MinTime, [&]() { Arrays->GetObjectArray(TEXT("objects")); }));
+
+		Arrays->RemoveFromRoot();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	// Reflection conversion
+	{
+		const int32 NumRecords = 1000;
+		TArray<UJsonBenchmarkRecord*> Records;
+		for (int32 i = 0; i < NumRecords; i++) {
+			Records.Add(MakeRecord(i));
+			Records.Last()->AddToRoot();
+		}
+
+		UJsonFieldData* Document = NewObject<UJsonFieldData>();
+		Document->AddToRoot();
+		auto SetAll = [&]() {
+			for (int32 i = 0; i < NumRecords; i++) {
+				Document->SetUObject(FString::Printf(TEXT("record_%d"), i), Records[i]);
+			}
+		};
+		SetAll();
+		const int64 RecordBytes = FTCHARToUTF8(*Document->GetContentString()).Length();
+
+		Results.Add(Measure(TEXT("records.SetUObject"), RecordBytes, MinTime, SetAll));
+		Results.Last().TreeBlocks = CountTreeBlocks(Document->Data);
+		Results.Add(Measure(TEXT("records.GetUObjectField"), RecordBytes, MinTime, [&]() {
+			bool bSuccess = false;
+			for (int32 i = 0; i < NumRecords; i++) {
+				Document->GetUObjectField(FString::Printf(TEXT("record_%d"), i), Records[i], bSuccess);
+			}
+		}));
+
+		Document->RemoveFromRoot();
+		for (UJsonBenchmarkRecord* Record : Records) {
+			Record->RemoveFromRoot();
+		}
+	}
+
+	// Report and compare with the baseline
+	UJsonFieldData* Baseline = NewObject<UJsonFieldData>();
+	Baseline->AddToRoot();
+	FString BaselineText;
+	const bool bHasBaseline = !bWriteBaseline && FFileHelper::LoadFileToString(BaselineText, *BaselineFile);
+	if (bHasBaseline) {
+		Baseline->FromString(BaselineText);
+	}
+
+	int32 NumRegressions = 0;
+	UE_LOG(LogJson, Display, TEXT("%-36s %10s %12s %12s %14s"), TEXT("Case"), TEXT("MB/s"), TEXT("ms"), TEXT("Tree blocks"), TEXT("RSS growth KB"));
+	for (const FResult& Result : Results)
+	{
+		FString Verdict;
+		const TSharedPtr<FJsonObject>* Reference = nullptr;
+		if (bHasBaseline && Baseline->Data->TryGetObjectField(Result.Name, Reference))
+		{
+			const double BaselineMBps = (*Reference)->GetNumberField(TEXT("MBps"));
+			const double BaselineBlocks = (*Reference)->GetNumberField(TEXT("TreeBlocks"));
+			if (Result.MBps() < BaselineMBps * (1.0 - Tolerance)) {
+				Verdict += FString::Printf(TEXT(" SLOWER (baseline %.1f MB/s)"), BaselineMBps);
+			}
+			if (BaselineBlocks > 0 && Result.TreeBlocks > BaselineBlocks * (1.0 + Tolerance)) {
+				Verdict += FString::Printf(TEXT(" MORE TREE BLOCKS (baseline %.0f)"), BaselineBlocks);
+			}
+			NumRegressions += Verdict.IsEmpty() ? 0 : 1;
+		}
+
+		UE_LOG(LogJson, Display, TEXT("%-36s %10.1f %12.3f %12lld %14lld%s"),
+			*Result.Name, Result.MBps(), Result.Seconds * 1000.0, Result.TreeBlocks, Result.ResidentGrowth / 1024, *Verdict);
+	}
+
+	if (bWriteBaseline)
+	{
+		UJsonFieldData* Output = NewObject<UJsonFieldData>();
+		for (const FResult& Result : Results) {
+			UJsonFieldData* Entry = NewObject<UJsonFieldData>(Output);
+			Entry->SetNumber(TEXT("MBps"), (float)Result.MBps())->SetNumber(TEXT("TreeBlocks"), (float)Result.TreeBlocks);
+			Output->SetObject(Result.Name, Entry);
+		}
+		if (FFileHelper::SaveStringToFile(Output->GetPrettyString(), *BaselineFile)) {
+			UE_LOG(LogJson, Display, TEXT("Benchmark baseline written to %s"), *BaselineFile);
+		}
+		else {
+			UE_LOG(LogJson, Error, TEXT("Unable to write the benchmark baseline to %s"), *BaselineFile);
+			NumRegressions++;
+		}
+	}
+	else if (!bHasBaseline && bRequireBaseline) {
+		UE_LOG(LogJson, Error, TEXT("No baseline at %s, nothing to check against. Run with -WriteBaseline and check the file in"), *BaselineFile);
+		NumRegressions++;
+	}
+	else if (!bHasBaseline) {
+		UE_LOG(LogJson, Display, TEXT("No baseline at %s, run with -WriteBaseline to create one"), *BaselineFile);
+	}
+
+	Baseline->RemoveFromRoot();
+
+	if (NumRegressions > 0) {
+		UE_LOG(LogJson, Error, TEXT("%d benchmark case(s) regressed beyond %.0f%%"), NumRegressions, Tolerance * 100.f);
+		return 1;
+	}
+	return 0;
+}
+#else
+int32 UJsonBenchmarkCommandlet::Main(const FString& Params)
+{
+	UE_LOG(LogJson, Error, TEXT("The JSON benchmark is not available in shipping builds"));
+	return 1;
+}
+#endif
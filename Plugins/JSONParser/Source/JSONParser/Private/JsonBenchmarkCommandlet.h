@@ -0,0 +1,75 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "JsonBenchmarkCommandlet.generated.h"
+
+/**
+* Object converted by the SetUObject / GetUObjectField benchmark
+*/
+UCLASS(Transient)
+class UJsonBenchmarkRecord : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(SaveGame)
+	int32 Level = 0;
+
+	UPROPERTY(SaveGame)
+	float Health = 0.f;
+
+	UPROPERTY(SaveGame)
+	FString DisplayName;
+
+	UPROPERTY(SaveGame)
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(SaveGame)
+	TArray<float> Samples;
+
+	UPROPERTY(SaveGame)
+	TArray<FVector> Path;
+
+	UPROPERTY(SaveGame)
+	TMap<FString, int32> Counters;
+};
+
+/**
+* Measures the parser and the serializer over JSON corpora and compares the results with a stored baseline.
+*
+* UnrealEditor-Cmd <Project> -run=JsonBenchmark -nullrhi [-Corpus=<dir with twitter.json, canada.json, citm_catalog.json>]
+*     [-Baseline=<file>] [-WriteBaseline] [-CI] [-Tolerance=0.15] [-MinTime=0.5]
+*
+* The baseline defaults to Benchmarks/BenchmarkBaseline.json in the plugin directory.
+* Returns 1 when a case is slower, or builds more tree blocks, than the baseline allows, and with -CI or on build
+* machines when there is no baseline to check against.
+*/
+UCLASS()
+class UJsonBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UJsonBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
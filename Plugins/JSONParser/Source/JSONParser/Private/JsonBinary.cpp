@@ -0,0 +1,539 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonBinary.h"
+
+#include "JsonBytes.h"
+#include "JsonGlobals.h"
+#include "JsonNumber.h"
+#include "JsonParserStats.h"
+#include "JsonRecordArray.h"
+#include "JsonTree.h"
+#include "JsonValueType.h"
+
+namespace JsonBinary
+{
+	static const uint8 Magic[4] = { 'J', 'S', 'N', 'B' };
+
+	class FWriter
+	{
+	public:
+		explicit FWriter(TArray<uint8>& InOut)
+			: Out(InOut)
+		{
+		}
+
+		void WriteVarint(uint64 Value)
+		{
+			do {
+				uint8 Byte = Value & 0x7F;
+				Value >>= 7;
+				Out.Add(Value ? (Byte | 0x80) : Byte);
+			} while (Value);
+		}
+
+		void WriteString(const FString& Value)
+		{
+			FTCHARToUTF8 Utf8(*Value, Value.Len());
+			WriteVarint(Utf8.Length());
+			Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		}
+
+		void WriteKey(const FString& Key)
+		{
+			// 0 introduces a new key, N refers to the key N-1 already written
+			if (const int32* Index = Keys.Find(Key)) {
+				WriteVarint(*Index + 1);
+				return;
+			}
+			Keys.Add(Key, Keys.Num());
+			WriteVarint(0);
+			WriteString(Key);
+		}
+
+		/* Returns false if containers deeper than MaxDepth were written as null */
+		bool WriteDocument(const FJsonObject& Root)
+		{
+			WriteObject(Root, 1);
+			while (Items.Num()) {
+				const FItem Item = Items.Pop(false);
+				if (Item.Records) {
+					WriteRecord(*Item.Records, *Item.Slots, Item.Index, Item.Depth);
+					continue;
+				}
+				if (Item.Key) {
+					WriteKey(*Item.Key);
+				}
+				WriteValue(*Item.Value, Item.Depth);
+			}
+			return !bTruncated;
+		}
+
+		int32 MaxDepth = FJsonBinary::DefaultMaxDepth;
+
+	private:
+		/* A value left to write, or a record of a flat record array */
+		struct FItem
+		{
+			const FString* Key;
+			const TSharedPtr<FJsonValue>* Value;
+			const FJsonValueRecordArray* Records;
+			const FJsonValueRecordArray::FSlots* Slots;
+			int32 Index;
+
+			/* Depth of the containers opened by the value */
+			int32 Depth;
+		};
+
+		/* Items are popped from the end, the children of a container are pushed in reverse order */
+		void ReverseItems(int32 First)
+		{
+			for (int32 Low = First, High = Items.Num() - 1; Low < High; ++Low, --High) {
+				Items.Swap(Low, High);
+			}
+		}
+
+		void WriteObject(const FJsonObject& Object, int32 Depth)
+		{
+			Out.Add((uint8)FJsonBinary::ETag::Object);
+			WriteVarint(Object.Values.Num());
+
+			const int32 First = Items.Num();
+			for (const auto& Pair : Object.Values) {
+				Items.Add({ &Pair.Key, &Pair.Value, nullptr, nullptr, 0, Depth + 1 });
+			}
+			ReverseItems(First);
+		}
+
+		/* Same encoding as an object, without building it */
+		void WriteRecord(const FJsonValueRecordArray& Records, const FJsonValueRecordArray::FSlots& Slots, int32 Index, int32 Depth)
+		{
+			const FJsonShape& Shape = Records.GetShape();
+			Out.Add((uint8)FJsonBinary::ETag::Object);
+			WriteVarint(Shape.Num());
+
+			const TSharedPtr<FJsonValue>* Record = Records.GetRecord(Slots, Index);
+			for (int32 Slot = Shape.Num() - 1; Slot >= 0; --Slot) {
+				Items.Add({ &Shape.Keys[Slot], &Record[Slot], nullptr, nullptr, 0, Depth + 1 });
+			}
+		}
+
+		void WriteValue(const TSharedPtr<FJsonValue>& Value, int32 Depth)
+		{
+			if (!Value.IsValid()) {
+				Out.Add((uint8)FJsonBinary::ETag::Null);
+				return;
+			}
+
+			// Containers past the limit are cut, a cycle in the tree would never end otherwise
+			if ((Value->Type == EJson::Array || Value->Type == EJson::Object) && Depth > MaxDepth) {
+				bTruncated = true;
+				Out.Add((uint8)FJsonBinary::ETag::Null);
+				return;
+			}
+
+			switch (Value->Type)
+			{
+			case EJson::Boolean:
+				Out.Add((uint8)(Value->AsBool() ? FJsonBinary::ETag::True : FJsonBinary::ETag::False));
+				break;
+			case EJson::Number:
+			{
+				int64 Integer;
+				if (JsonNumber::TryGetInteger(*Value, Integer)) {
+					Out.Add((uint8)FJsonBinary::ETag::Integer);
+					WriteVarint(((uint64)Integer << 1) ^ (uint64)(Integer >> 63));
+					break;
+				}
+				Out.Add((uint8)FJsonBinary::ETag::Number);
+				const double Number = Value->AsNumber();
+				Out.Append(reinterpret_cast<const uint8*>(&Number), sizeof(Number));
+				break;
+			}
+			case EJson::String:
+				if (JsonValueType::IsString(*Value)) {
+					Out.Add((uint8)FJsonBinary::ETag::String);
+					WriteString(JsonValueType::GetString(*Value));
+					break;
+				}
+				// Binary fields keep their raw bytes, with the alphabet they are written with as text
+				if (const FJsonValueBytes* Bytes = FJsonValueBytes::Cast(*Value)) {
+					Out.Add((uint8)FJsonBinary::ETag::Bytes);
+					Out.Add(Bytes->IsUrlSafe() ? 1 : 0);
+					WriteVarint(Bytes->GetBytes().Num());
+					Out.Append(Bytes->GetBytes());
+					break;
+				}
+				Out.Add((uint8)FJsonBinary::ETag::String);
+				WriteString(Value->AsString());
+				break;
+			case EJson::Array:
+			{
+				const FJsonValueRecordArray* Records = FJsonValueRecordArray::Cast(*Value);
+				TSharedPtr<const FJsonValueRecordArray::FSlots> Slots = Records ? Records->PinSlots() : nullptr;
+				if (Slots.IsValid()) {
+					Out.Add((uint8)FJsonBinary::ETag::Array);
+					WriteVarint(Records->Num());
+					for (int32 Index = Records->Num() - 1; Index >= 0; --Index) {
+						Items.Add({ nullptr, nullptr, Records, Slots.Get(), Index, Depth + 1 });
+					}
+					Pinned.Add(MoveTemp(Slots));
+					break;
+				}
+				const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+				Out.Add((uint8)FJsonBinary::ETag::Array);
+				WriteVarint(Array.Num());
+				for (int32 Index = Array.Num() - 1; Index >= 0; --Index) {
+					Items.Add({ nullptr, &Array[Index], nullptr, nullptr, 0, Depth + 1 });
+				}
+				break;
+			}
+			case EJson::Object:
+			{
+				const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+				if (Object.IsValid()) {
+					WriteObject(*Object, Depth);
+				}
+				else {
+					Out.Add((uint8)FJsonBinary::ETag::Null);
+				}
+				break;
+			}
+			default:
+				Out.Add((uint8)FJsonBinary::ETag::Null);
+				break;
+			}
+		}
+
+		TArray<uint8>& Out;
+		TMap<FString, int32> Keys;
+		TArray<FItem> Items;
+		bool bTruncated = false;
+
+		/* Flat values of the record arrays being written */
+		TArray<TSharedPtr<const FJsonValueRecordArray::FSlots>> Pinned;
+	};
+
+	class FReader
+	{
+	public:
+		explicit FReader(TArrayView<const uint8> InBuffer)
+			: Buffer(InBuffer)
+		{
+		}
+
+		bool ReadVarint(uint64& Value)
+		{
+			Value = 0;
+			for (int32 Shift = 0; Shift < 64; Shift += 7) {
+				if (Offset >= Buffer.Num()) {
+					return false;
+				}
+				const uint8 Byte = Buffer[Offset++];
+				Value |= uint64(Byte & 0x7F) << Shift;
+				if (!(Byte & 0x80)) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool ReadString(FString& Value)
+		{
+			uint64 Length;
+			if (!ReadVarint(Length) || Length > uint64(Buffer.Num() - Offset)) {
+				return false;
+			}
+			FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData() + Offset), (int32)Length);
+			Value = FString(Converted.Length(), Converted.Get());
+			Offset += (int32)Length;
+			return true;
+		}
+
+		bool ReadKey(FString& Key)
+		{
+			uint64 Index;
+			if (!ReadVarint(Index)) {
+				return false;
+			}
+			if (Index == 0) {
+				if (!ReadString(Key)) {
+					return false;
+				}
+				Keys.Add(Key);
+				return true;
+			}
+			if (Index > uint64(Keys.Num())) {
+				return false;
+			}
+			Key = Keys[Index - 1];
+			return true;
+		}
+
+		~FReader()
+		{
+			// A corrupted document leaves the containers being read on the stack
+			for (FFrame& Frame : Stack) {
+				JsonTree::Release(MoveTemp(Frame.Object));
+				JsonTree::Release(MoveTemp(Frame.Values));
+			}
+		}
+
+		/* Reads the root object, its tag already consumed */
+		bool ReadDocument(TSharedPtr<FJsonObject>& OutObject)
+		{
+			if (!PushFrame(FJsonBinary::ETag::Object)) {
+				return false;
+			}
+
+			while (true) {
+				FFrame& Frame = Stack.Last();
+				if (Frame.Remaining == 0) {
+					// The container is complete, hand it to its parent
+					TSharedPtr<FJsonValue> Value;
+					if (Frame.Object.IsValid()) {
+						if (Stack.Num() == 1) {
+							OutObject = MoveTemp(Frame.Object);
+							Stack.Pop(false);
+							return true;
+						}
+						Value = MakeShared<FJsonValueObject>(MoveTemp(Frame.Object));
+					}
+					else {
+						Value = MakeShared<FJsonValueArray>(MoveTemp(Frame.Values));
+					}
+					Stack.Pop(false);
+					AddToParent(MoveTemp(Value));
+					continue;
+				}
+
+				--Frame.Remaining;
+				if (Frame.Object.IsValid() && !ReadKey(Frame.Key)) {
+					return false;
+				}
+				if (Offset >= Buffer.Num()) {
+					return false;
+				}
+
+				// Containers push a frame, their value is added once they are complete
+				const FJsonBinary::ETag Tag = (FJsonBinary::ETag)Buffer[Offset++];
+				if (Tag == FJsonBinary::ETag::Array || Tag == FJsonBinary::ETag::Object) {
+					if (!PushFrame(Tag)) {
+						return false;
+					}
+					continue;
+				}
+
+				TSharedPtr<FJsonValue> Value;
+				if (!ReadScalar(Tag, Value)) {
+					return false;
+				}
+				AddToParent(MoveTemp(Value));
+			}
+		}
+
+		int32 Offset = 0;
+		int32 MaxDepth = FJsonBinary::DefaultMaxDepth;
+
+	private:
+		/* A container being read */
+		struct FFrame
+		{
+			/* Set for objects, arrays collect Values */
+			TSharedPtr<FJsonObject> Object;
+			TArray<TSharedPtr<FJsonValue>> Values;
+			FString Key;
+			uint64 Remaining = 0;
+		};
+
+		bool PushFrame(FJsonBinary::ETag Tag)
+		{
+			uint64 Count;
+			if (Stack.Num() >= MaxDepth || !ReadVarint(Count) || Count > uint64(Buffer.Num() - Offset)) {
+				return false;
+			}
+
+			FFrame& Frame = Stack.AddDefaulted_GetRef();
+			Frame.Remaining = Count;
+			if (Tag == FJsonBinary::ETag::Object) {
+				Frame.Object = MakeShared<FJsonObject>();
+				Frame.Object->Values.Reserve((int32)Count);
+			}
+			else {
+				Frame.Values.Reserve((int32)Count);
+			}
+			return true;
+		}
+
+		void AddToParent(TSharedPtr<FJsonValue>&& Value)
+		{
+			FFrame& Parent = Stack.Last();
+			if (Parent.Object.IsValid()) {
+				Parent.Object->Values.Add(MoveTemp(Parent.Key), MoveTemp(Value));
+			}
+			else {
+				Parent.Values.Add(MoveTemp(Value));
+			}
+		}
+
+		bool ReadScalar(FJsonBinary::ETag Tag, TSharedPtr<FJsonValue>& Value)
+		{
+			switch (Tag)
+			{
+			case FJsonBinary::ETag::Null:
+				Value = MakeShared<FJsonValueNull>();
+				return true;
+			case FJsonBinary::ETag::False:
+				Value = MakeShared<FJsonValueBoolean>(false);
+				return true;
+			case FJsonBinary::ETag::True:
+				Value = MakeShared<FJsonValueBoolean>(true);
+				return true;
+			case FJsonBinary::ETag::Number:
+			{
+				double Number;
+				if (Offset + (int32)sizeof(Number) > Buffer.Num()) {
+					return false;
+				}
+				FMemory::Memcpy(&Number, Buffer.GetData() + Offset, sizeof(Number));
+				Offset += sizeof(Number);
+				Value = MakeShared<FJsonValueNumber>(Number);
+				return true;
+			}
+			case FJsonBinary::ETag::Integer:
+			{
+				uint64 Encoded;
+				if (!ReadVarint(Encoded)) {
+					return false;
+				}
+				const int64 Integer = (int64)(Encoded >> 1) ^ -(int64)(Encoded & 1);
+				if (Integer > JsonNumber::MaxExactInteger || Integer < -JsonNumber::MaxExactInteger) {
+					Value = MakeShared<FJsonValueNumberString>(LexToString(Integer));
+				}
+				else {
+					Value = MakeShared<FJsonValueNumber>((double)Integer);
+				}
+				return true;
+			}
+			case FJsonBinary::ETag::String:
+			{
+				FString String;
+				if (!ReadString(String)) {
+					return false;
+				}
+				Value = MakeShared<FJsonValueString>(MoveTemp(String));
+				return true;
+			}
+			case FJsonBinary::ETag::Bytes:
+			{
+				uint64 Length;
+				if (Offset >= Buffer.Num()) {
+					return false;
+				}
+				const bool bUrlSafe = Buffer[Offset++] != 0;
+				if (!ReadVarint(Length) || Length > uint64(Buffer.Num() - Offset)) {
+					return false;
+				}
+				TArray<uint8> Bytes(Buffer.GetData() + Offset, (int32)Length);
+				Offset += (int32)Length;
+				Value = MakeShared<FJsonValueBytes>(MoveTemp(Bytes), bUrlSafe);
+				return true;
+			}
+			default:
+				return false;
+			}
+		}
+
+		TArrayView<const uint8> Buffer;
+		TArray<FString> Keys;
+		TArray<FFrame> Stack;
+	};
+}
+
+/**
+* Appends the binary encoding of the document to the buffer
+*
+* @param	Object		Root object
+* @param	Out			Destination buffer
+* @param	MaxDepth	Containers nested deeper are written as null
+*/
+void FJsonBinary::Write(const TSharedPtr<FJsonObject>& Object, TArray<uint8>& Out, int32 MaxDepth)
+{
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonBinaryWrite);
+	LLM_SCOPE_BYTAG(JSONParser);
+	const int32 StartSize = Out.Num();
+
+	Out.Append(JsonBinary::Magic, UE_ARRAY_COUNT(JsonBinary::Magic));
+	Out.Add(Version);
+
+	JsonBinary::FWriter Writer(Out);
+	Writer.MaxDepth = MaxDepth;
+	const FJsonObject Empty;
+	if (!Writer.WriteDocument(Object.IsValid() ? *Object : Empty)) {
+		UE_LOG(LogJson, Warning, TEXT("Binary JSON: containers nested deeper than %d levels were written as null"), MaxDepth);
+	}
+
+	JSON_COUNT_BYTES_WRITTEN(Out.Num() - StartSize);
+}
+
+/**
+* Decodes a binary document
+*
+* @param	Buffer		Encoded document
+* @param	OutObject	Root object, only set on success
+* @param	MaxDepth	Documents nested deeper are rejected
+*
+* @return	True if the buffer was a valid document
+*/
+bool FJsonBinary::Read(TArrayView<const uint8> Buffer, TSharedPtr<FJsonObject>& OutObject, int32 MaxDepth)
+{
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonBinaryRead);
+	LLM_SCOPE_BYTAG(JSONParser);
+	JSON_COUNT_BYTES_PARSED(Buffer.Num());
+
+	if (!IsBinary(Buffer)) {
+		UE_LOG(LogJson, Warning, TEXT("Binary JSON: invalid header"));
+		return false;
+	}
+
+	JsonBinary::FReader Reader(Buffer);
+	Reader.Offset = UE_ARRAY_COUNT(JsonBinary::Magic) + 1;
+	Reader.MaxDepth = MaxDepth;
+
+	if (Reader.Offset >= Buffer.Num() || Buffer[Reader.Offset++] != (uint8)ETag::Object) {
+		UE_LOG(LogJson, Warning, TEXT("Binary JSON: the root is not an object"));
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Object;
+	if (!Reader.ReadDocument(Object)) {
+		UE_LOG(LogJson, Warning, TEXT("Binary JSON: truncated, corrupted or too deep data at offset %d"), Reader.Offset);
+		return false;
+	}
+
+	// The document being replaced can be as deep as the new one
+	Swap(OutObject, Object);
+	JsonTree::Release(MoveTemp(Object));
+	return true;
+}
+
+bool FJsonBinary::IsBinary(TArrayView<const uint8> Buffer)
+{
+	return Buffer.Num() > UE_ARRAY_COUNT(JsonBinary::Magic)
+		&& FMemory::Memcmp(Buffer.GetData(), JsonBinary::Magic, UE_ARRAY_COUNT(JsonBinary::Magic)) == 0
+		&& Buffer[UE_ARRAY_COUNT(JsonBinary::Magic)] >= 1
+		&& Buffer[UE_ARRAY_COUNT(JsonBinary::Magic)] <= Version;
+}
@@ -0,0 +1,207 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonBuilder.h"
+#include "JsonParserStats.h"
+#include "JsonTextWriter.h"
+#include "JsonNumber.h"
+
+FJsonBuilder::FJsonBuilder(FString& InOut, int32 InMaxDecimals)
+	: Out(InOut)
+	, MaxDecimals(InMaxDecimals)
+{
+}
+
+FJsonBuilder::FJsonBuilder(FArchive& InArchive, int32 InMaxDecimals, int32 InFlushSize)
+	: Out(Buffer)
+	, MaxDecimals(InMaxDecimals)
+	, Archive(&InArchive)
+	, FlushSize(FMath::Max(InFlushSize, 1))
+{
+	Buffer.Reserve(FlushSize + 256);
+}
+
+FJsonBuilder::~FJsonBuilder()
+{
+	if (Archive) {
+		WriteBuffered();
+	}
+}
+
+void FJsonBuilder::WriteBuffered()
+{
+	if (Out.IsEmpty()) {
+		return;
+	}
+
+	FTCHARToUTF8 Utf8(*Out, Out.Len());
+	Archive->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	BytesWritten += Utf8.Length();
+	JSON_COUNT_BYTES_WRITTEN(Utf8.Length());
+
+	// Keeps the allocation for the next chunk
+	Out.Reset();
+}
+
+bool FJsonBuilder::Flush()
+{
+	if (!Archive) {
+		return true;
+	}
+	WriteBuffered();
+	Archive->Flush();
+	return !Archive->IsError();
+}
+
+void FJsonBuilder::BeginValue()
+{
+	checkf(Scopes.Num() > 0 || bFirst, TEXT("A JSON document has a single root value"));
+
+	// Flushed between values only, so that a chunk never ends inside a string
+	if (Archive && Out.Len() >= FlushSize) {
+		WriteBuffered();
+	}
+	if (!bFirst) {
+		Out.AppendChar(',');
+	}
+	bFirst = false;
+}
+
+FJsonBuilder& FJsonBuilder::BeginObject()
+{
+	BeginValue();
+	Out.AppendChar('{');
+	Scopes.Add(true);
+	bFirst = true;
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::BeginObject(FStringView InKey)
+{
+	return Key(InKey).BeginObject();
+}
+
+FJsonBuilder& FJsonBuilder::EndObject()
+{
+	checkf(Scopes.Num() > 0 && Scopes.Last(), TEXT("EndObject does not match an open object"));
+	Scopes.Pop(false);
+	Out.AppendChar('}');
+	bFirst = false;
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::BeginArray()
+{
+	BeginValue();
+	Out.AppendChar('[');
+	Scopes.Add(false);
+	bFirst = true;
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::BeginArray(FStringView InKey)
+{
+	return Key(InKey).BeginArray();
+}
+
+FJsonBuilder& FJsonBuilder::EndArray()
+{
+	checkf(Scopes.Num() > 0 && !Scopes.Last(), TEXT("EndArray does not match an open array"));
+	Scopes.Pop(false);
+	Out.AppendChar(']');
+	bFirst = false;
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::Key(FStringView InKey)
+{
+	checkf(Scopes.Num() > 0 && Scopes.Last(), TEXT("Keys are only valid inside an object"));
+	BeginValue();
+	FJsonTextWriter::AppendString(Out, InKey);
+	Out.AppendChar(':');
+
+	// The value which follows belongs to this key, no comma before it
+	bFirst = true;
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::Value(bool InValue)
+{
+	BeginValue();
+	if (InValue) {
+		Out.AppendChars(TEXT("true"), 4);
+	}
+	else {
+		Out.AppendChars(TEXT("false"), 5);
+	}
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::Value(int32 InValue)
+{
+	return Value((int64)InValue);
+}
+
+FJsonBuilder& FJsonBuilder::Value(uint32 InValue)
+{
+	return Value((int64)InValue);
+}
+
+FJsonBuilder& FJsonBuilder::Value(int64 InValue)
+{
+	BeginValue();
+	TCHAR Buffer[JsonNumber::MaxFormattedLength];
+	Out.AppendChars(Buffer, JsonNumber::FormatInteger(InValue, Buffer));
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::Value(double InValue)
+{
+	BeginValue();
+	FJsonTextWriter::AppendNumber(Out, InValue, MaxDecimals);
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::Value(const TCHAR* InValue)
+{
+	return Value(FStringView(InValue));
+}
+
+FJsonBuilder& FJsonBuilder::Value(FStringView InValue)
+{
+	BeginValue();
+	FJsonTextWriter::AppendString(Out, InValue);
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::Value(const FName& InValue)
+{
+	return Value(FStringView(InValue.ToString()));
+}
+
+FJsonBuilder& FJsonBuilder::Value(const FJsonObject& InValue)
+{
+	BeginValue();
+	FJsonTextWriter(Out, false, MaxDecimals).WriteObject(InValue);
+	return *this;
+}
+
+FJsonBuilder& FJsonBuilder::Null()
+{
+	BeginValue();
+	Out.AppendChars(TEXT("null"), 4);
+	return *this;
+}
@@ -0,0 +1,80 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonBytes.h"
+#include "JsonBase64.h"
+#include "JsonValueType.h"
+
+const TCHAR* FJsonValueBytes::TypeName = TEXT("Bytes");
+
+TAtomic<int32> FJsonValueBytes::NumLive { 0 };
+
+FJsonValueBytes::FJsonValueBytes(TArray<uint8>&& InBytes, bool bInUrlSafe)
+	: Bytes(MoveTemp(InBytes))
+	, bUrlSafe(bInUrlSafe)
+{
+	Type = EJson::String;
+	++NumLive;
+}
+
+FJsonValueBytes::~FJsonValueBytes()
+{
+	--NumLive;
+}
+
+bool FJsonValueBytes::TryGetString(FString& OutString) const
+{
+	OutString.Reset();
+	JsonBase64::Encode(Bytes.GetData(), Bytes.Num(), OutString, bUrlSafe);
+	return true;
+}
+
+void FJsonValueBytes::AppendQuoted(FString& Out) const
+{
+	// The base64 alphabets need no escaping
+	Out.AppendChar('"');
+	JsonBase64::Encode(Bytes.GetData(), Bytes.Num(), Out, bUrlSafe);
+	Out.AppendChar('"');
+}
+
+const FJsonValueBytes* FJsonValueBytes::Cast(const FJsonValue& Value)
+{
+	// The value being read is alive, so a count of zero rules it out; the name is only built while binary values exist
+	if (Value.Type != EJson::String || NumLive.Load(EMemoryOrder::Relaxed) == 0 || JsonValueType::GetName(Value) != TypeName) {
+		return nullptr;
+	}
+	return static_cast<const FJsonValueBytes*>(&Value);
+}
+
+bool FJsonValueBytes::TryGetBytes(const FJsonValue& Value, TArray<uint8>& OutBytes)
+{
+	if (Value.Type != EJson::String) {
+		return false;
+	}
+
+	// Strings read from text, decoded in place
+	if (JsonValueType::IsString(Value)) {
+		return JsonBase64::Decode(JsonValueType::GetString(Value), OutBytes);
+	}
+
+	if (const FJsonValueBytes* Bytes = Cast(Value)) {
+		OutBytes = Bytes->Bytes;
+		return true;
+	}
+
+	FString String;
+	return Value.TryGetString(String) && JsonBase64::Decode(String, OutBytes);
+}
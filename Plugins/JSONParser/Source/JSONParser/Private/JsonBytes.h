@@ -0,0 +1,72 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * A binary field: one byte buffer instead of an array of numbers, written as a base64 string.
+ * It reads as a string, TryGetString encodes it on each call; the writers encode it straight into their output.
+ * The bytes never change after construction, so the value can be shared between documents and snapshots.
+ */
+class FJsonValueBytes : public FJsonValue
+{
+public:
+	FJsonValueBytes(TArray<uint8>&& InBytes, bool bInUrlSafe);
+	virtual ~FJsonValueBytes();
+
+	virtual bool TryGetString(FString& OutString) const override;
+
+	const TArray<uint8>& GetBytes() const
+	{
+		return Bytes;
+	}
+
+	/* Written with the unpadded URL alphabet instead of the standard one */
+	bool IsUrlSafe() const
+	{
+		return bUrlSafe;
+	}
+
+	/* Append the quoted base64 text */
+	void AppendQuoted(FString& Out) const;
+
+	/* The binary value behind a value, nullptr for any other value */
+	static const FJsonValueBytes* Cast(const FJsonValue& Value);
+
+	/**
+	 * Bytes held by a string value: binary values give their buffer, plain strings are decoded from their characters
+	 * without being copied first. Returns false for other types and for strings which are not base64.
+	 */
+	static bool TryGetBytes(const FJsonValue& Value, TArray<uint8>& OutBytes);
+
+	static const TCHAR* TypeName;
+
+protected:
+	virtual FString GetType() const override
+	{
+		return TypeName;
+	}
+
+private:
+	const TArray<uint8> Bytes;
+	const bool bUrlSafe;
+
+	/* Binary values alive, while there are none Cast returns without building the type name */
+	static TAtomic<int32> NumLive;
+};
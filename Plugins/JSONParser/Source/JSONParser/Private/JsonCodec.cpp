@@ -0,0 +1,176 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonCodec.h"
+#include "JsonNumber.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace JsonCodec
+{
+	namespace
+	{
+		struct FPendingCodec
+		{
+			UScriptStruct* (*GetStruct)();
+			FStructCodec Codec;
+		};
+
+		/* Registration runs during static initialization, the structs are resolved on the first lookup */
+		struct FRegistryState
+		{
+			FRWLock Lock;
+			TArray<FPendingCodec> Pending;
+			TMap<const UScriptStruct*, FStructCodec> Codecs;
+		};
+
+		FRegistryState& GetRegistry()
+		{
+			static FRegistryState Registry;
+			return Registry;
+		}
+
+		double GetNumberField(const FJsonObject& Object, const TCHAR* Key, double Default)
+		{
+			double Value = Default;
+			Object.TryGetNumberField(Key, Value);
+			return Value;
+		}
+	}
+
+	bool ReadInteger(const FJsonValue& Json, int64& OutValue)
+	{
+		return JsonNumber::TryGetInteger(Json, OutValue);
+	}
+
+	TSharedPtr<FJsonValue> MakeInteger(int64 Value)
+	{
+		if (Value > JsonNumber::MaxExactInteger || Value < -JsonNumber::MaxExactInteger) {
+			TCHAR Buffer[JsonNumber::MaxFormattedLength];
+			const int32 Length = JsonNumber::FormatInteger(Value, Buffer);
+			return MakeShared<FJsonValueNumberString>(FString(Length, Buffer));
+		}
+		return MakeShared<FJsonValueNumber>(double(Value));
+	}
+
+	TSharedPtr<FJsonValue> ToJson(const FVector& Value)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetNumberField(TEXT("X"), Value.X);
+		Object->SetNumberField(TEXT("Y"), Value.Y);
+		Object->SetNumberField(TEXT("Z"), Value.Z);
+		return MakeShared<FJsonValueObject>(Object);
+	}
+
+	TSharedPtr<FJsonValue> ToJson(const FRotator& Value)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetNumberField(TEXT("Pitch"), Value.Pitch);
+		Object->SetNumberField(TEXT("Yaw"), Value.Yaw);
+		Object->SetNumberField(TEXT("Roll"), Value.Roll);
+		return MakeShared<FJsonValueObject>(Object);
+	}
+
+	TSharedPtr<FJsonValue> ToJson(const FLinearColor& Value)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetNumberField(TEXT("R"), Value.R);
+		Object->SetNumberField(TEXT("G"), Value.G);
+		Object->SetNumberField(TEXT("B"), Value.B);
+		Object->SetNumberField(TEXT("A"), Value.A);
+		return MakeShared<FJsonValueObject>(Object);
+	}
+
+	bool FromJson(const FJsonValue& Json, FName& Out)
+	{
+		FString Value;
+		if (!Json.TryGetString(Value)) {
+			return false;
+		}
+		Out = FName(*Value);
+		return true;
+	}
+
+	bool FromJson(const FJsonValue& Json, FVector& Out)
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if (!Json.TryGetObject(Object)) {
+			return false;
+		}
+		Out.X = GetNumberField(**Object, TEXT("X"), Out.X);
+		Out.Y = GetNumberField(**Object, TEXT("Y"), Out.Y);
+		Out.Z = GetNumberField(**Object, TEXT("Z"), Out.Z);
+		return true;
+	}
+
+	bool FromJson(const FJsonValue& Json, FRotator& Out)
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if (!Json.TryGetObject(Object)) {
+			return false;
+		}
+		Out.Pitch = GetNumberField(**Object, TEXT("Pitch"), Out.Pitch);
+		Out.Yaw = GetNumberField(**Object, TEXT("Yaw"), Out.Yaw);
+		Out.Roll = GetNumberField(**Object, TEXT("Roll"), Out.Roll);
+		return true;
+	}
+
+	bool FromJson(const FJsonValue& Json, FLinearColor& Out)
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if (!Json.TryGetObject(Object)) {
+			return false;
+		}
+		Out.R = GetNumberField(**Object, TEXT("R"), Out.R);
+		Out.G = GetNumberField(**Object, TEXT("G"), Out.G);
+		Out.B = GetNumberField(**Object, TEXT("B"), Out.B);
+		Out.A = GetNumberField(**Object, TEXT("A"), Out.A);
+		return true;
+	}
+
+	void FRegistry::Register(UScriptStruct* (*GetStruct)(), const FStructCodec& Codec)
+	{
+		FRegistryState& Registry = GetRegistry();
+		FWriteScopeLock Lock(Registry.Lock);
+		Registry.Pending.Add({ GetStruct, Codec });
+	}
+
+	bool FRegistry::Find(const UScriptStruct* Struct, FStructCodec& OutCodec)
+	{
+		FRegistryState& Registry = GetRegistry();
+		{
+			FReadScopeLock Lock(Registry.Lock);
+			if (Registry.Pending.Num() == 0) {
+				const FStructCodec* Codec = Registry.Codecs.Find(Struct);
+				if (Codec) {
+					OutCodec = *Codec;
+				}
+				return Codec != nullptr;
+			}
+		}
+
+		FWriteScopeLock Lock(Registry.Lock);
+		for (const FPendingCodec& Pending : Registry.Pending) {
+			Registry.Codecs.Add(Pending.GetStruct(), Pending.Codec);
+		}
+		Registry.Pending.Reset();
+
+		const FStructCodec* Codec = Registry.Codecs.Find(Struct);
+		if (Codec) {
+			OutCodec = *Codec;
+		}
+		return Codec != nullptr;
+	}
+}
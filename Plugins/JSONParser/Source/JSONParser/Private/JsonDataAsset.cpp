@@ -0,0 +1,115 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonDataAsset.h"
+#include "JsonBinary.h"
+#include "JsonFieldData.h"
+#include "JsonGlobals.h"
+#include "JsonTree.h"
+
+#if WITH_EDITORONLY_DATA
+#include "EditorFramework/AssetImportData.h"
+#endif
+
+/**
+* Decodes the binary document on the first call, later calls return the same root
+*
+* @return	The document, invalid if the asset holds no valid document
+*/
+FJsonSnapshot UJsonDataAsset::GetSnapshot() const
+{
+	FScopeLock Lock(&DecodeLock);
+	if (!Root.IsValid() && Binary.Num()) {
+		LLM_SCOPE_BYTAG(JSONParser);
+		if (!FJsonBinary::Read(Binary, Root)) {
+			UE_LOG(LogJson, Warning, TEXT("Invalid binary document in %s"), *GetPathName());
+			Root.Reset();
+		}
+	}
+	return FJsonSnapshot(Root, 0);
+}
+
+UJsonFieldData* UJsonDataAsset::GetJson(UObject* WorldContextObject) const
+{
+	const FJsonSnapshot Snapshot = GetSnapshot();
+	if (!Snapshot.IsValid()) {
+		return UJsonFieldData::Create(WorldContextObject);
+	}
+	return UJsonFieldData::CreateFromJson(WorldContextObject, ConstCastSharedPtr<FJsonObject>(Snapshot.GetRoot()), true);
+}
+
+int32 UJsonDataAsset::GetBinarySize() const
+{
+	return Binary.Num();
+}
+
+void UJsonDataAsset::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	// One block, uint8 arrays are bulk serialized
+	Ar << Binary;
+
+	if (Ar.IsLoading()) {
+		FScopeLock Lock(&DecodeLock);
+		JsonTree::Release(MoveTemp(Root));
+	}
+}
+
+void UJsonDataAsset::BeginDestroy()
+{
+	{
+		FScopeLock Lock(&DecodeLock);
+		JsonTree::Release(MoveTemp(Root));
+	}
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+bool UJsonDataAsset::ImportText(const FString& Text)
+{
+	TSharedPtr<FJsonObject> Object;
+	if (!UJsonFieldData::DeserializeObject(Text, Object)) {
+		return false;
+	}
+
+	TArray<uint8> Encoded;
+	FJsonBinary::Write(Object, Encoded);
+
+	FScopeLock Lock(&DecodeLock);
+	Binary = MoveTemp(Encoded);
+	Swap(Root, Object);
+	JsonTree::Release(MoveTemp(Object));
+	return true;
+}
+
+void UJsonDataAsset::PostInitProperties()
+{
+	if (!HasAnyFlags(RF_ClassDefaultObject)) {
+		AssetImportData = NewObject<UAssetImportData>(this, TEXT("AssetImportData"));
+	}
+	Super::PostInitProperties();
+}
+
+void UJsonDataAsset::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
+{
+	// The source file lets the editor reimport the asset when the file changes
+	if (AssetImportData) {
+		OutTags.Add(FAssetRegistryTag(SourceFileTagName(), AssetImportData->GetSourceData().ToJson(), FAssetRegistryTag::TT_Hidden));
+	}
+	Super::GetAssetRegistryTags(OutTags);
+}
+#endif
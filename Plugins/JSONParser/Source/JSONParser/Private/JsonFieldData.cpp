@@ -15,19 +15,323 @@ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHO
 WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 #include "JsonFieldData.h"
+#include "JsonAssets.h"
+#include "JsonBinary.h"
+#include "JsonBytes.h"
+#include "JsonParserStats.h"
+#include "JsonProjection.h"
+#include "JsonTextReader.h"
+#include "JsonTextWriter.h"
+#include "JsonTree.h"
+#include "JsonValueType.h"
+#include "JsonNumber.h"
+#include "JsonRecordArray.h"
+#include "JsonTexture.h"
 
-#include "ImageUtils.h"
 #include "Misc/Compression.h"
 #include "Engine/UserDefinedEnum.h"
-#include "Policies/CondensedJsonPrintPolicy.h"
-#include "Policies/PrettyJsonPrintPolicy.h"
-#include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 
-typedef TJsonWriterFactory< TCHAR, TCondensedJsonPrintPolicy<TCHAR> > FCondensedJsonStringWriterFactory;
-typedef TJsonWriter< TCHAR, TCondensedJsonPrintPolicy<TCHAR> > FCondensedJsonStringWriter;
-typedef TJsonWriterFactory< TCHAR, TPrettyJsonPrintPolicy<TCHAR> > FPrettyJsonStringWriterFactory;
-typedef TJsonWriter< TCHAR, TPrettyJsonPrintPolicy<TCHAR> > FPrettyJsonStringWriter;
+/**
+* State shared by the views of a document. In copy-on-write mode, Owned lists the objects the document may write
+* in place; any other object may be shared with another document or a snapshot and is cloned on its first write.
+* Weak pointers keep a freed object whose address is reused from passing as owned.
+*/
+struct FJsonCowState
+{
+	TMap<const FJsonObject*, TWeakPtr<FJsonObject>> Owned;
+
+	/* Arrays copied since the objects were last shared, the views of their elements replace them in place */
+	TMap<const FJsonValue*, TWeakPtr<FJsonValue>> OwnedArrays;
+
+	bool bEnabled = false;
+
+	/* Writes are refused, the document is a snapshot */
+	bool bFrozen = false;
+
+	/* Version of the last snapshot, and whether the document changed since */
+	uint64 Version = 0;
+	bool bChangedSinceSnapshot = true;
+
+	bool IsOwned(const TSharedPtr<FJsonObject>& Object) const
+	{
+		const TWeakPtr<FJsonObject>* Weak = Owned.Find(Object.Get());
+		return Weak && Weak->Pin() == Object;
+	}
+
+	void Own(const TSharedPtr<FJsonObject>& Object)
+	{
+		Owned.Add(Object.Get(), Object);
+	}
+
+	bool IsOwned(const TSharedPtr<FJsonValue>& Array) const
+	{
+		const TWeakPtr<FJsonValue>* Weak = OwnedArrays.Find(Array.Get());
+		return Weak && Weak->Pin() == Array;
+	}
+
+	void Own(const TSharedPtr<FJsonValue>& Array)
+	{
+		OwnedArrays.Add(Array.Get(), Array);
+	}
+
+	/* Everything is shared again, the next write to each object or array copies it */
+	void Disown()
+	{
+		Owned.Reset();
+		OwnedArrays.Reset();
+	}
+};
+
+/**
+* Object table of a graph being written. Objects get their id before their properties are written, so a reference
+* back to an object still being written resolves to its id instead of recursing.
+*/
+struct FJsonObjectGraphWriter
+{
+	TMap<const UObject*, int32> Ids;
+	TArray<TSharedPtr<FJsonValue>> Objects;
+
+	/* Graph written by the property walk on this thread, null outside of graph mode */
+	static thread_local FJsonObjectGraphWriter* Active;
+
+	int32 Add(const UObject* Object, TSharedPtr<FJsonObject>(*Write)(const UObject*))
+	{
+		if (const int32* Id = Ids.Find(Object)) {
+			return *Id;
+		}
+
+		const int32 Id = Objects.AddDefaulted();
+		Ids.Add(Object, Id);
+
+		TSharedPtr<FJsonObject> Fields = Write(Object);
+		Fields->SetStringField(TEXT("$class"), Object->GetClass()->GetPathName());
+		Objects[Id] = MakeShared<FJsonValueObject>(Fields);
+		return Id;
+	}
+
+	static TSharedPtr<FJsonObject> MakeReference(int32 Id)
+	{
+		TSharedPtr<FJsonObject> Reference = MakeShared<FJsonObject>();
+		Reference->SetNumberField(TEXT("$ref"), Id);
+		return Reference;
+	}
+};
+
+thread_local FJsonObjectGraphWriter* FJsonObjectGraphWriter::Active = nullptr;
+
+/**
+* Object table of a graph being read. Each id resolves to one instance: the object the property already holds when
+* it has the right class, a new object of the written class otherwise. Instances are registered before their
+* properties are read, which closes cycles.
+*/
+struct FJsonObjectGraphReader
+{
+	const TArray<TSharedPtr<FJsonValue>>& Table;
+	TArray<UObject*> Instances;
+
+	/* Outer of the objects created while reading */
+	UObject* Outer;
+
+	static thread_local FJsonObjectGraphReader* Active;
+
+	FJsonObjectGraphReader(const TArray<TSharedPtr<FJsonValue>>& InTable, UObject* InOuter)
+		: Table(InTable)
+		, Outer(InOuter)
+	{
+		Instances.SetNumZeroed(Table.Num());
+	}
+
+	UObject* Resolve(int32 Id, UClass* BaseClass, UObject* Existing, void(*Read)(const FJsonObject&, UObject*))
+	{
+		if (!Instances.IsValidIndex(Id)) {
+			UE_LOG(LogJson, Warning, TEXT("Object graph: unknown reference %d"), Id);
+			return nullptr;
+		}
+		if (Instances[Id]) {
+			return Instances[Id]->IsA(BaseClass) ? Instances[Id] : nullptr;
+		}
+
+		const TSharedPtr<FJsonObject>* Fields;
+		if (!Table[Id].IsValid() || !Table[Id]->TryGetObject(Fields)) {
+			return nullptr;
+		}
+
+		// The class is only looked up, a path read from the document never loads a package
+		FString ClassPath;
+		UClass* Class = (*Fields)->TryGetStringField(TEXT("$class"), ClassPath) ? Cast<UClass>(JsonAssets::FindLoaded(ClassPath)) : nullptr;
+		if (!Class || !Class->IsChildOf(BaseClass)) {
+			Class = BaseClass;
+		}
+
+		UObject* Object = Existing && Existing->IsA(Class) ? Existing : nullptr;
+		if (!Object) {
+			if (Class->HasAnyClassFlags(CLASS_Abstract)) {
+				UE_LOG(LogJson, Warning, TEXT("Object graph: cannot create object %d of abstract class %s"), Id, *Class->GetName());
+				return nullptr;
+			}
+			Object = NewObject<UObject>(Outer, Class);
+		}
+
+		Instances[Id] = Object;
+		Read(**Fields, Object);
+		return Object;
+	}
+};
+
+thread_local FJsonObjectGraphReader* FJsonObjectGraphReader::Active = nullptr;
+
+/* Objects being written as nested copies on this thread, to stop at cycles */
+struct FJsonObjectVisit
+{
+	static thread_local TArray<const UObject*> Stack;
+
+	explicit FJsonObjectVisit(const UObject* Object)
+	{
+		Stack.Push(Object);
+	}
+
+	~FJsonObjectVisit()
+	{
+		Stack.Pop(false);
+	}
+};
+
+thread_local TArray<const UObject*> FJsonObjectVisit::Stack;
+
+namespace
+{
+	/**
+	 * Copies a document with an explicit stack, the depth only costs heap memory.
+	 * Containers are allocated empty when their parent is copied and filled when they are popped. Other values cannot
+	 * be modified and are shared.
+	 */
+	class FJsonCloner
+	{
+	public:
+		TSharedPtr<FJsonObject> CloneObject(const FJsonObject& Root)
+		{
+			TSharedPtr<FJsonObject> Clone = MakeShared<FJsonObject>();
+			Pending.Add({ &Root, Clone.Get(), nullptr, nullptr });
+			while (Pending.Num()) {
+				const FPending Item = Pending.Pop(false);
+				if (Item.Object) {
+					Item.ObjectClone->Values.Reserve(Item.Object->Values.Num());
+					for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Item.Object->Values) {
+						Item.ObjectClone->Values.Add(Field.Key, CloneShell(Field.Value));
+					}
+				}
+				else {
+					Item.ArrayClone->Reserve(Item.Array->Num());
+					for (const TSharedPtr<FJsonValue>& Element : *Item.Array) {
+						Item.ArrayClone->Add(CloneShell(Element));
+					}
+				}
+			}
+			Pinned.Empty();
+			return Clone;
+		}
+
+	private:
+		/* A container copied empty, filled from its source when popped */
+		struct FPending
+		{
+			const FJsonObject* Object;
+			FJsonObject* ObjectClone;
+			const TArray<TSharedPtr<FJsonValue>>* Array;
+			TArray<TSharedPtr<FJsonValue>>* ArrayClone;
+		};
+
+		TSharedPtr<FJsonValue> CloneShell(const TSharedPtr<FJsonValue>& Value)
+		{
+			if (!Value.IsValid()) {
+				return Value;
+			}
+
+			if (Value->Type == EJson::Object) {
+				const TSharedPtr<FJsonObject>* Object;
+				if (Value->TryGetObject(Object) && Object->IsValid()) {
+					TSharedPtr<FJsonObject> Clone = MakeShared<FJsonObject>();
+					Pending.Add({ Object->Get(), Clone.Get(), nullptr, nullptr });
+					return MakeShared<FJsonValueObject>(MoveTemp(Clone));
+				}
+			}
+			else if (Value->Type == EJson::Array) {
+				// Flat record arrays keep their shared shape, their slots are copied at once
+				const FJsonValueRecordArray* Records = FJsonValueRecordArray::Cast(*Value);
+				TSharedPtr<const FJsonValueRecordArray::FSlots> Flat = Records ? Records->PinSlots() : nullptr;
+				if (Flat.IsValid()) {
+					TArray<TSharedPtr<FJsonValue>> Slots;
+					Slots.Reserve(Flat->Num());
+					for (const TSharedPtr<FJsonValue>& Slot : *Flat) {
+						Slots.Add(CloneShell(Slot));
+					}
+					// The objects of the slots are read when popped
+					Pinned.Add(MoveTemp(Flat));
+					return MakeShared<FJsonValueRecordArray>(Records->GetSharedShape(), MoveTemp(Slots), Records->Num());
+				}
+
+				const TArray<TSharedPtr<FJsonValue>>* Elements;
+				if (Value->TryGetArray(Elements)) {
+					TSharedRef<FJsonValueArray> Clone = MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>());
+					Pending.Add({ nullptr, nullptr, Elements, &JsonValueType::GetMutableArray(*Clone) });
+					return Clone;
+				}
+			}
+
+			return Value;
+		}
+
+		TArray<FPending> Pending;
+		TArray<TSharedPtr<const FJsonValueRecordArray::FSlots>> Pinned;
+	};
+
+	TSharedPtr<FJsonObject> CloneObject(const FJsonObject& Object)
+	{
+		return FJsonCloner().CloneObject(Object);
+	}
+
+	/* The FJsonObject::TryGet*Field tests, on a value found with FindField */
+	bool TryGetStringField(const TSharedPtr<FJsonValue>& Field, FString& OutString)
+	{
+		return Field.IsValid() && Field->TryGetString(OutString);
+	}
+
+	bool TryGetNumberField(const TSharedPtr<FJsonValue>& Field, double& OutNumber)
+	{
+		return Field.IsValid() && Field->TryGetNumber(OutNumber);
+	}
+
+	bool TryGetArrayField(const TSharedPtr<FJsonValue>& Field, const TArray<TSharedPtr<FJsonValue>>*& OutArray)
+	{
+		return Field.IsValid() && Field->TryGetArray(OutArray);
+	}
+
+	bool TryGetObjectField(const TSharedPtr<FJsonValue>& Field, const TSharedPtr<FJsonObject>*& OutObject)
+	{
+		return Field.IsValid() && Field->TryGetObject(OutObject);
+	}
+
+	/* Byte of a number, clamped to [0, 255]: a plain cast of a value out of range wraps or is undefined */
+	bool TryGetByte(const FJsonValue& Value, uint8& OutByte)
+	{
+		int64 Integer;
+		if (JsonNumber::TryGetInteger(Value, Integer)) {
+			OutByte = (uint8)FMath::Clamp<int64>(Integer, 0, 255);
+			return true;
+		}
+
+		// Fractions are truncated, 3.5 reads as 3
+		double Number;
+		if (Value.TryGetNumber(Number)) {
+			OutByte = (uint8)FMath::Clamp(FMath::TruncToDouble(Number), 0.0, 255.0);
+			return true;
+		}
+		return false;
+	}
+}
 
 //////////////////////////////////////////////////////////////////////////
 // UJsonFieldData
@@ -41,16 +345,22 @@ UJsonFieldData::UJsonFieldData(const class FObjectInitializer& PCIP)
 	Reset();
 }
 
+/**
+* Releases the document before the object is destroyed, a deep document would recurse once per level otherwise
+*/
+void UJsonFieldData::BeginDestroy()
+{
+	JsonTree::Release(MoveTemp(Data));
+	Super::BeginDestroy();
+}
+
 /**
 * Resets the current page data
 *
 */
 void UJsonFieldData::Reset() {
-	// If the post data is valid
-	if (Data.IsValid()) {
-		// Clear the current post data
-		Data.Reset();
-	}
+	// Clear the current post data, deep documents are released without recursion
+	JsonTree::Release(MoveTemp(Data));
 
 	// Create a new JSON object
 	Data = MakeShareable(new FJsonObject());
@@ -63,16 +373,7 @@ void UJsonFieldData::Reset() {
 */
 FString UJsonFieldData::GetContentString()
 {
-	if (!Data.IsValid())
-	{
-		return TEXT("");
-	}
-
-	FString outStr;
-	TSharedRef< FCondensedJsonStringWriter > Writer = FCondensedJsonStringWriterFactory::Create(&outStr);
-	FJsonSerializer::Serialize(Data.ToSharedRef(), Writer);
-
-	return outStr;
+	return SerializeObject(ReadObject(), false, MaxDecimals);
 }
 
 /**
@@ -82,18 +383,93 @@ FString UJsonFieldData::GetContentString()
 */
 FString UJsonFieldData::GetPrettyString()
 {
-	if (!Data.IsValid())
+	return SerializeObject(ReadObject(), true, MaxDecimals);
+}
+
+/**
+* Serialize a JSON object to a String
+*
+* @param	Object		The object to serialize
+* @param	bPretty		Use the pretty layout instead of the condensed one
+* @param	MaxDecimals	Number of decimals kept for numbers, negative for the shortest exact form
+* @param	bOutComplete	Optional, receives false if containers nested too deep were written as null
+*
+* @return	A string representation of the object, empty if the object is invalid
+*/
+FString UJsonFieldData::SerializeObject(const TSharedPtr<FJsonObject>& Object, bool bPretty, int32 MaxDecimals, bool* bOutComplete)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!Object.IsValid())
 	{
 		return TEXT("");
 	}
 
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonSerialize);
+
 	FString outStr;
-	TSharedRef< FPrettyJsonStringWriter > Writer = FPrettyJsonStringWriterFactory::Create(&outStr);
-	FJsonSerializer::Serialize(Data.ToSharedRef(), Writer);
+	FJsonTextWriter Writer(outStr, bPretty, MaxDecimals);
+	const bool bComplete = Writer.WriteObject(*Object);
+	if (!bComplete) {
+		UE_LOG(LogJson, Warning, TEXT("JSON: containers nested deeper than %d levels were written as null"), FJsonTextWriter::DefaultMaxDepth);
+	}
+	if (bOutComplete) {
+		*bOutComplete = bComplete;
+	}
 
+	JSON_COUNT_TEXT_WRITTEN(outStr);
 	return outStr;
 }
 
+/**
+* Limit the number of decimals written by GetContentString and GetPrettyString
+*
+* @param	Decimals	Number of decimals, negative for the shortest form that reads back exactly
+*
+* @return	This
+*/
+UJsonFieldData* UJsonFieldData::SetNumberPrecision(int32 Decimals)
+{
+	MaxDecimals = Decimals < 0 ? -1 : Decimals;
+	return this;
+}
+
+/**
+* Enables the object graph mode: UObjects are written in an object table, once each, and every property referencing
+* one holds {"$ref": id} instead of a nested copy. Get UObject Field resolves the references back to shared instances.
+*
+* @param	bEnabled		Write object graphs
+*
+* @return	This
+*/
+UJsonFieldData* UJsonFieldData::SetObjectGraph(bool bEnabled)
+{
+	bObjectGraph = bEnabled;
+	return this;
+}
+
+/**
+* Deserialize a JSON string into an object
+*
+* @param	Text		The JSON string
+* @param	OutObject	The resulting object
+* @param	Projection	Fields to build, the others are skipped. Null reads the whole document
+*
+* @return	True if the string was a valid JSON object
+*/
+bool UJsonFieldData::DeserializeObject(const FString& Text, TSharedPtr<FJsonObject>& OutObject, const FJsonProjection* Projection)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonParse);
+	JSON_COUNT_TEXT_PARSED(Text);
+
+	FString Error;
+	if (!FJsonTextReader::ReadObject(Text, OutObject, &Error, FJsonTextReader::DefaultMaxDepth, Projection)) {
+		UE_LOG(LogJson, Verbose, TEXT("%s"), *Error);
+		return false;
+	}
+	return true;
+}
+
 /**
 * Serialize the JSON to a compressed format
 * 
@@ -103,7 +479,214 @@ FString UJsonFieldData::GetPrettyString()
 */
  void UJsonFieldData::GetContentCompressed(TArray<uint8>& Compressed, bool& bIsValid)
 {
-	FString UncompressedData = GetContentString();
+	bIsValid = CompressString(GetContentString(), Compressed);
+}
+
+/**
+* Serialize the JSON to the compact binary format
+*
+* @param	Binary		An array to store the result
+*
+*/
+void UJsonFieldData::GetContentBinary(TArray<uint8>& Binary)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	Binary.Reset();
+	FJsonBinary::Write(ReadObject(), Binary);
+}
+
+/**
+* Get the memory held by the document
+*
+* @return	Bytes by node type, shared nodes are counted once
+*/
+FJsonMemoryFootprint UJsonFieldData::GetMemoryFootprint() const
+{
+	return ComputeMemoryFootprint(ReadObject());
+}
+
+/**
+* Walk a JSON object and sum the memory of its nodes, the walk is iterative so deep documents are safe
+*
+* @param	Object		The root object
+*
+* @return	Bytes by node type
+*/
+FJsonMemoryFootprint UJsonFieldData::ComputeMemoryFootprint(const TSharedPtr<FJsonObject>& Object)
+{
+	FJsonMemoryFootprint Footprint;
+	if (!Object.IsValid()) {
+		return Footprint;
+	}
+
+	// MakeShareable allocates the reference controller next to every node: vtable and two counters
+	constexpr int64 ControllerBytes = sizeof(void*) + 2 * sizeof(int32);
+
+	TSet<const void*> Visited;
+	TArray<const FJsonObject*> Objects;
+	TArray<const FJsonValue*> Values;
+	Objects.Add(Object.Get());
+	Visited.Add(Object.Get());
+
+	while (Objects.Num() || Values.Num()) {
+		if (Objects.Num()) {
+			const FJsonObject* Current = Objects.Pop(false);
+			Footprint.ObjectBytes += sizeof(FJsonObject) + ControllerBytes + Current->Values.GetAllocatedSize();
+			Footprint.NodeCount++;
+
+			for (const auto& Pair : Current->Values) {
+				Footprint.KeyBytes += Pair.Key.GetAllocatedSize();
+				Footprint.KeyCount++;
+				if (Pair.Value.IsValid() && !Visited.Contains(Pair.Value.Get())) {
+					Visited.Add(Pair.Value.Get());
+					Values.Add(Pair.Value.Get());
+				}
+			}
+			continue;
+		}
+
+		const FJsonValue* Value = Values.Pop(false);
+		Footprint.NodeCount++;
+
+		switch (Value->Type) {
+		case EJson::Object:
+		{
+			Footprint.ObjectBytes += sizeof(FJsonValueObject) + ControllerBytes;
+			const TSharedPtr<FJsonObject>& Child = Value->AsObject();
+			if (Child.IsValid() && !Visited.Contains(Child.Get())) {
+				Visited.Add(Child.Get());
+				Objects.Add(Child.Get());
+			}
+			break;
+		}
+		case EJson::Array:
+		{
+			// Record arrays are walked in place, reading them as an array would build every record
+			const FJsonValueRecordArray* Records = FJsonValueRecordArray::Cast(*Value);
+			const TSharedPtr<const FJsonValueRecordArray::FSlots> Flat = Records ? Records->PinSlots() : nullptr;
+			if (Flat.IsValid()) {
+				const FJsonShape& Shape = Records->GetShape();
+				Footprint.ArrayBytes += sizeof(FJsonValueRecordArray) + sizeof(FJsonValueRecordArray::FSlots) + 2 * ControllerBytes + Flat->GetAllocatedSize();
+				if (!Visited.Contains(&Shape)) {
+					Visited.Add(&Shape);
+					Footprint.KeyBytes += sizeof(FJsonShape) + ControllerBytes + Shape.Keys.GetAllocatedSize() + Shape.Slots.GetAllocatedSize();
+					for (const FString& Key : Shape.Keys) {
+						Footprint.KeyBytes += 2 * Key.GetAllocatedSize();
+						Footprint.KeyCount++;
+					}
+				}
+				for (const TSharedPtr<FJsonValue>& Element : *Flat) {
+					if (Element.IsValid() && !Visited.Contains(Element.Get())) {
+						Visited.Add(Element.Get());
+						Values.Add(Element.Get());
+					}
+				}
+				break;
+			}
+
+			const TArray<TSharedPtr<FJsonValue>>& Elements = Value->AsArray();
+			Footprint.ArrayBytes += sizeof(FJsonValueArray) + ControllerBytes + Elements.GetAllocatedSize();
+			for (const TSharedPtr<FJsonValue>& Element : Elements) {
+				if (Element.IsValid() && !Visited.Contains(Element.Get())) {
+					Visited.Add(Element.Get());
+					Values.Add(Element.Get());
+				}
+			}
+			break;
+		}
+		case EJson::String:
+		{
+			if (const FJsonValueBytes* Bytes = FJsonValueBytes::Cast(*Value)) {
+				Footprint.StringBytes += sizeof(FJsonValueBytes) + ControllerBytes + Bytes->GetBytes().GetAllocatedSize();
+				break;
+			}
+
+			// AsString returns a copy, its length is enough to estimate the original allocation
+			const int32 Length = Value->AsString().Len();
+			Footprint.StringBytes += sizeof(FJsonValueString) + ControllerBytes + (Length ? (Length + 1) * sizeof(TCHAR) : 0);
+			break;
+		}
+		case EJson::Number:
+			Footprint.NumberBytes += sizeof(FJsonValueNumber) + ControllerBytes;
+			break;
+		case EJson::Boolean:
+			Footprint.OtherBytes += sizeof(FJsonValueBoolean) + ControllerBytes;
+			break;
+		default:
+			Footprint.OtherBytes += sizeof(FJsonValueNull) + ControllerBytes;
+			break;
+		}
+	}
+
+	Footprint.TotalBytes = Footprint.ObjectBytes + Footprint.ArrayBytes + Footprint.StringBytes
+		+ Footprint.NumberBytes + Footprint.OtherBytes + Footprint.KeyBytes;
+	return Footprint;
+}
+
+/**
+* Console command listing the largest live documents, views sharing the same data are grouped.
+* The path of each view shows its outer chain, which is usually what keeps a leaked document alive.
+*
+* @param	Args		Optional number of documents to list, 10 by default
+*/
+static void ListJsonDocuments(const TArray<FString>& Args)
+{
+	const int32 MaxCount = Args.Num() ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10;
+
+	TMap<const FJsonObject*, TArray<const UJsonFieldData*>> Documents;
+	for (TObjectIterator<UJsonFieldData> It; It; ++It) {
+		if (It->Data.IsValid()) {
+			Documents.FindOrAdd(It->Data.Get()).Add(*It);
+		}
+	}
+
+	struct FEntry
+	{
+		FJsonMemoryFootprint Footprint;
+		const TArray<const UJsonFieldData*>* Views;
+	};
+
+	TArray<FEntry> Entries;
+	Entries.Reserve(Documents.Num());
+	int64 TotalBytes = 0;
+	for (const auto& Pair : Documents) {
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Footprint = UJsonFieldData::ComputeMemoryFootprint(Pair.Value[0]->Data);
+		Entry.Views = &Pair.Value;
+		TotalBytes += Entry.Footprint.TotalBytes;
+	}
+	Entries.Sort([](const FEntry& A, const FEntry& B) { return A.Footprint.TotalBytes > B.Footprint.TotalBytes; });
+
+	UE_LOG(LogJson, Display, TEXT("%d JSON documents, %.2f KB total"), Entries.Num(), TotalBytes / 1024.0);
+	for (int32 Index = 0; Index < FMath::Min(MaxCount, Entries.Num()); ++Index) {
+		const FEntry& Entry = Entries[Index];
+		const FJsonMemoryFootprint& F = Entry.Footprint;
+		UE_LOG(LogJson, Display, TEXT("%8.2f KB  %d nodes  (objects %lld, arrays %lld, strings %lld, numbers %lld, other %lld, keys %lld)  %d view(s)"),
+			F.TotalBytes / 1024.0, F.NodeCount, F.ObjectBytes, F.ArrayBytes, F.StringBytes, F.NumberBytes, F.OtherBytes, F.KeyBytes, Entry.Views->Num());
+		for (const UJsonFieldData* View : *Entry.Views) {
+			UE_LOG(LogJson, Display, TEXT("            %s"), *View->GetPathName());
+		}
+	}
+}
+
+static FAutoConsoleCommand ListJsonDocumentsCommand(
+	TEXT("JSONParser.ListDocuments"),
+	TEXT("Lists the largest live JSON documents with their memory footprint and outer chain. Usage: JSONParser.ListDocuments [Count]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&ListJsonDocuments));
+
+/**
+* Compress a string, the result starts with the uncompressed size
+*
+* @param	UncompressedData	The string to compress
+* @param	Compressed			An array to store the result, untouched on failure
+*
+* @return	The status of the compression
+*/
+bool UJsonFieldData::CompressString(const FString& UncompressedData, TArray<uint8>& Compressed)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonCompress);
+
 	uint32 UncompressedSize = sizeof(TCHAR)*(UncompressedData.Len());
 
 	int32 CompressedSize = FCompression::CompressMemoryBound(TEXT("ZLIB"), UncompressedSize);
@@ -111,13 +694,48 @@ FString UJsonFieldData::GetPrettyString()
 	CompressedData.AddUninitialized(CompressedSize + sizeof(UncompressedSize));
 	
 	FMemory::Memcpy(&CompressedData[0], &UncompressedSize, sizeof(UncompressedSize));
-	bIsValid = FCompression::CompressMemory(TEXT("ZLIB"), CompressedData.GetData() + sizeof(UncompressedSize), CompressedSize, *UncompressedData, UncompressedSize);
+	const bool bIsValid = FCompression::CompressMemory(TEXT("ZLIB"), CompressedData.GetData() + sizeof(UncompressedSize), CompressedSize, *UncompressedData, UncompressedSize);
 	
 	if (bIsValid) {
 		CompressedData.SetNum(CompressedSize+ sizeof(UncompressedSize), false);
+		INC_DWORD_STAT_BY(STAT_JsonBytesCompressed, CompressedData.Num());
 
-		Compressed = CompressedData;
+		Compressed = MoveTemp(CompressedData);
 	}
+	return bIsValid;
+}
+
+/**
+* Uncompress a buffer produced by CompressString
+*
+* @param	Compressed			The compressed buffer
+* @param	UncompressedData	The resulting string
+*
+* @return	The status of the decompression
+*/
+bool UJsonFieldData::UncompressString(const TArray<uint8>& Compressed, FString& UncompressedData)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonUncompress);
+
+	int32 UncompressedSize;
+	if (Compressed.Num() < (int32)sizeof(UncompressedSize)) {
+		return false;
+	}
+
+	FMemory::Memcpy(&UncompressedSize, &Compressed[0], sizeof(UncompressedSize));
+	if (UncompressedSize < 0 || UncompressedSize % sizeof(TCHAR) != 0) {
+		return false;
+	}
+
+	TArray<TCHAR> Buffer;
+	Buffer.SetNumUninitialized(UncompressedSize / sizeof(TCHAR));
+	if (!FCompression::UncompressMemory(TEXT("ZLIB"), Buffer.GetData(), UncompressedSize, Compressed.GetData() + sizeof(UncompressedSize), Compressed.Num() - sizeof(UncompressedSize))) {
+		return false;
+	}
+
+	UncompressedData = FString(Buffer.Num(), Buffer.GetData());
+	return true;
 }
 
 /**
@@ -128,9 +746,7 @@ FString UJsonFieldData::GetPrettyString()
 * @return	A pointer to the newly created post data
 */
 UJsonFieldData* UJsonFieldData::Create(UObject* WorldContextObject) {
-	// Get the world object from the context
-	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
-
+	LLM_SCOPE_BYTAG(JSONParser);
 	// Construct the object and return it
 	UJsonFieldData* fieldData = NewObject<UJsonFieldData>(WorldContextObject);
 	fieldData->contextObject = WorldContextObject;
@@ -144,11 +760,17 @@ UJsonFieldData* UJsonFieldData::Create(UObject* WorldContextObject) {
 *
 * @return	A pointer to the newly created post data
 */
-UJsonFieldData * UJsonFieldData::CreateFromJson(UObject * WorldContextObject, TSharedPtr<FJsonObject> data)
+UJsonFieldData * UJsonFieldData::CreateFromJson(UObject * WorldContextObject, TSharedPtr<FJsonObject> data, bool bCopyOnWrite)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 	const auto Json = UJsonFieldData::Create(WorldContextObject);
 	if (Json && Json->IsValidLowLevel()) {
 		Json->Data = data;
+
+		// Nothing is owned yet, the first write clones the objects on its path
+		if (bCopyOnWrite) {
+			Json->SetCopyOnWrite(true);
+		}
 	}
 
 	return Json;
@@ -164,6 +786,7 @@ UJsonFieldData * UJsonFieldData::CreateFromJson(UObject * WorldContextObject, TS
 */
 UJsonFieldData* UJsonFieldData::CreateFromString(UObject* WorldContextObject, const FString& data)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 	if (data.IsEmpty()) {
 		return NULL;
 	}
@@ -177,74 +800,28 @@ UJsonFieldData* UJsonFieldData::CreateFromString(UObject* WorldContextObject, co
 }
 
 /**
-* This function will write the supplied key and value to the JsonWriter
+* Create a new instance of the UJsonFieldData class holding some fields of a String
 *
-* @param	writer			The JsonWriter to use
-* @param	key				Object key
-* @param	value			Object value
+* @param	WorldContextObject		The current context
+* @param	data		The JSON string to load
+* @param	Fields		Paths of the fields to keep, see FromStringProjected
 *
+* @return	A pointer to the newly created post data
 */
-void UJsonFieldData::WriteObject(TSharedRef<TJsonWriter<TCHAR>> writer, FString key, FJsonValue* value) 
+UJsonFieldData* UJsonFieldData::CreateFromStringProjected(UObject* WorldContextObject, const FString& data, const TArray<FString>& Fields)
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
-		return;
-	}
-	if (value->Type == EJson::Boolean) {
-		// Write simple bool entry
-		if (!key.IsEmpty()) {
-			writer->WriteValue(key, value->AsBool());
-		}
-		
-	}
-	else if (value->Type == EJson::String) {
-		// Write simple string entry, don't a key when it isn't set
-		if (key.Len() > 0) {
-			writer->WriteValue(key, value->AsString());
-		}
-		else {
-			writer->WriteValue(value->AsString());
-		}
-	}
-	else if (value->Type == EJson::Number) {
-		// Write simple Number entry, don't a key when it isn't set
-		if (key.Len() > 0) {
-			writer->WriteValue(key, value->AsNumber());
-		}
-		else {
-			writer->WriteValue(value->AsNumber());
-		}
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (data.IsEmpty()) {
+		return NULL;
 	}
-	else if (value->Type == EJson::Object) {
-		// Write object entry
-		if (key.Len() > 0) {
-			writer->WriteObjectStart(key); }
-		else {
-			writer->WriteObjectStart(); }
-
-		// Loop through all the values in the object data
-		TSharedPtr<FJsonObject> objectData = value->AsObject();
-		for (auto objectValue = objectData->Values.CreateIterator(); objectValue; ++objectValue) {
-			// Using recursion to write the key and value to the writer
-			WriteObject(writer, objectValue.Key(), objectValue.Value().Get());
-		}
-
-		writer->WriteObjectEnd();
-
-	} else if (value->Type == EJson::Array) {
-		// Process array entry
-		writer->WriteArrayStart(key);
-			
-		TArray<TSharedPtr<FJsonValue>> objectArray = value->AsArray();
-		for (int32 i = 0; i < objectArray.Num(); i++) {
-			// Use recursion with an empty key to process all the values in the array
-			WriteObject(writer, "", objectArray[i].Get());
-		}
 
-		writer->WriteArrayEnd();
+	const auto Json = UJsonFieldData::Create(WorldContextObject);
+	if (Json && Json->IsValidLowLevel()) {
+		Json->FromStringProjected(data, Fields);
 	}
-}
-
 
+	return Json;
+}
 
 /**
 * Adds the supplied string to the post data, under the given key
@@ -256,10 +833,14 @@ void UJsonFieldData::WriteObject(TSharedRef<TJsonWriter<TCHAR>> writer, FString
 */
 UJsonFieldData* UJsonFieldData::SetString(const FString& key, const FString& value) 
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetStringField(*key,*value);
 	return this;
 }
@@ -273,17 +854,21 @@ UJsonFieldData* UJsonFieldData::SetString(const FString& key, const FString& val
 * @return	The object itself
 */
 UJsonFieldData* UJsonFieldData::SetObject(const FString& key, const UJsonFieldData* objectData) {
+	LLM_SCOPE_BYTAG(JSONParser);
 	
-	if (!Data.IsValid() || key.IsEmpty()) {
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	if (!objectData) {
 		Data->SetField(key, TSharedPtr<FJsonValueNull>(new FJsonValueNull()));
 		return this;
 	}
 	
-	Data->SetObjectField(key, objectData->Data);
+	Data->SetObjectField(key, ShareObject(objectData));
 	return this;
 }
 
@@ -298,12 +883,17 @@ UJsonFieldData* UJsonFieldData::SetObject(const FString& key, const UJsonFieldDa
 */
 UJsonFieldData* UJsonFieldData::SetUObject(const FString& key, const UObject* Container)
 {
-	if (!Data.IsValid() || key.IsEmpty() || !Container) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty() || !Container) {
 		return this;
 	}
 
-	UClass* ObjectClass = Container->GetClass();
-	TSharedPtr<FJsonObject> JsonObject = CreateJsonValueFromUObject(Container);
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonPropertyToJson);
+
+	TSharedPtr<FJsonObject> JsonObject = bObjectGraph ? CreateJsonGraphFromUObject(Container) : CreateJsonValueFromUObject(Container);
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetObjectField(*key, JsonObject);
 
 	return this;
@@ -319,7 +909,8 @@ UJsonFieldData* UJsonFieldData::SetUObject(const FString& key, const UObject* Co
 */
 UJsonFieldData * UJsonFieldData::SetClass(const FString & key, UClass* value)
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 
@@ -328,6 +919,9 @@ UJsonFieldData * UJsonFieldData::SetClass(const FString & key, UClass* value)
 	}
 
 	FString className = FStringClassReference(value).ToString();
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetStringField(*key, *className);
 	
 	return this;
@@ -343,7 +937,8 @@ UJsonFieldData * UJsonFieldData::SetClass(const FString & key, UClass* value)
 */
 UJsonFieldData * UJsonFieldData::SetClassArray(const FString & key, const TArray<UClass*> arrayData)
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 
@@ -355,6 +950,9 @@ UJsonFieldData * UJsonFieldData::SetClassArray(const FString & key, const TArray
 		classArray.Add(MakeShareable(new FJsonValueString(className)));
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetArrayField(*key, classArray);
 	return this;
 }
@@ -369,16 +967,20 @@ UJsonFieldData * UJsonFieldData::SetClassArray(const FString & key, const TArray
 */
 UJsonFieldData* UJsonFieldData::SetObjectArray(const FString& key, const TArray<UJsonFieldData*> objectData) 
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 	TArray<TSharedPtr<FJsonValue>> dataArray;
 
 	// Loop through the array and create new shared FJsonValueObject instances for every FJsonObject
 	for (int32 i = 0; i < objectData.Num(); i++) {
-		dataArray.Add(MakeShareable(new FJsonValueObject(objectData[i]->Data)));
+		dataArray.Add(MakeShareable(new FJsonValueObject(ShareObject(objectData[i]))));
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetArrayField(*key, dataArray);
 	return this;
 }
@@ -393,8 +995,9 @@ UJsonFieldData* UJsonFieldData::SetObjectArray(const FString& key, const TArray<
 */
 UJsonFieldData* UJsonFieldData::SetStringArray(const FString& key, const TArray<FString> stringData) 
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 
-	if (!Data.IsValid() || key.IsEmpty()) {
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 
@@ -405,6 +1008,9 @@ UJsonFieldData* UJsonFieldData::SetStringArray(const FString& key, const TArray<
 		dataArray.Add(MakeShareable(new FJsonValueString(stringData[i])));
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetArrayField(*key, dataArray);
 	return this;
 }
@@ -419,10 +1025,14 @@ UJsonFieldData* UJsonFieldData::SetStringArray(const FString& key, const TArray<
 */
 UJsonFieldData * UJsonFieldData::SetName(const FString & key, const FName & value)
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 	FString fromName = value.ToString();
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetStringField(*key, *fromName);
 	return this;
 }
@@ -437,7 +1047,8 @@ UJsonFieldData * UJsonFieldData::SetName(const FString & key, const FName & valu
 */
 UJsonFieldData * UJsonFieldData::SetNameArray(const FString & key, const TArray<FName> arrayData)
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 	TArray<TSharedPtr<FJsonValue>> dataArray;
@@ -447,6 +1058,9 @@ UJsonFieldData * UJsonFieldData::SetNameArray(const FString & key, const TArray<
 		dataArray.Add(MakeShareable(new FJsonValueString(arrayData[i].ToString())));
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetArrayField(*key, dataArray);
 	return this;
 }
@@ -461,7 +1075,11 @@ UJsonFieldData * UJsonFieldData::SetNameArray(const FString & key, const TArray<
 */
 UJsonFieldData * UJsonFieldData::SetByte(const FString & key, uint8 value)
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty()) {
+		return this;
+	}
+	if (!PrepareWrite()) {
 		return this;
 	}
 	Data->SetNumberField(*key, value);
@@ -478,21 +1096,49 @@ UJsonFieldData * UJsonFieldData::SetByte(const FString & key, uint8 value)
 */
 UJsonFieldData * UJsonFieldData::SetByteArray(const FString & key, const TArray<uint8> arrayData)
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 
 	TArray<TSharedPtr<FJsonValue>> dataArray;
+	dataArray.Reserve(arrayData.Num());
 
-	// Loop through the input array and add new shareable FJsonValueString instances to the data array
+	// Loop through the input array and add new shareable FJsonValueNumber instances to the data array
 	for (int32 i = 0; i < arrayData.Num(); i++) {
 		dataArray.Add(MakeShareable(new FJsonValueNumber(arrayData[i])));
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetArrayField(*key, dataArray);
 	return this;
 }
 
+/**
+* Adds the supplied bytes to the post data as a single binary value, written as base64
+*
+* @param	key						Key
+* @param	value					Bytes
+* @param	bUrlSafe				Write the unpadded URL alphabet
+*
+* @return	The object itself
+*/
+UJsonFieldData* UJsonFieldData::SetBinary(const FString& key, const TArray<uint8>& value, bool bUrlSafe)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || key.IsEmpty()) {
+		return this;
+	}
+
+	if (!PrepareWrite()) {
+		return this;
+	}
+	Data->SetField(key, MakeShared<FJsonValueBytes>(TArray<uint8>(value), bUrlSafe));
+	return this;
+}
+
 /**
 * Adds the supplied bool to the post data, under the given key
 *
@@ -503,7 +1149,11 @@ UJsonFieldData * UJsonFieldData::SetByteArray(const FString & key, const TArray<
 */
 UJsonFieldData * UJsonFieldData::SetBool(const FString & key, bool value)
 {
-	if (Data.IsValid() && !key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (HasData() && !key.IsEmpty()) {
+		if (!PrepareWrite()) {
+			return this;
+		}
 		Data->SetBoolField(key, value);
 	}
 	return this;
@@ -519,6 +1169,7 @@ UJsonFieldData * UJsonFieldData::SetBool(const FString & key, bool value)
 */
 UJsonFieldData * UJsonFieldData::SetBoolArray(const FString & key, const TArray<bool> arrayData)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 
 	if (key.IsEmpty()) {
 		return this;
@@ -531,6 +1182,9 @@ UJsonFieldData * UJsonFieldData::SetBoolArray(const FString & key, const TArray<
 		dataArray.Add(MakeShareable(new FJsonValueBoolean( k )));
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetArrayField(key, dataArray);
 	return this;
 }
@@ -545,7 +1199,11 @@ UJsonFieldData * UJsonFieldData::SetBoolArray(const FString & key, const TArray<
 */
 UJsonFieldData * UJsonFieldData::SetNumber(const FString & key, float value)
 {
-	if (Data.IsValid() && !key.IsEmpty()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (HasData() && !key.IsEmpty()) {
+		if (!PrepareWrite()) {
+			return this;
+		}
 		Data->SetNumberField(*key, value);
 	}
 	return this;
@@ -561,6 +1219,7 @@ UJsonFieldData * UJsonFieldData::SetNumber(const FString & key, float value)
 */
 UJsonFieldData * UJsonFieldData::SetNumberArray(const FString & key, const TArray<float> arrayData)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 	if (key.IsEmpty()) {
 		return this;
 	}
@@ -571,10 +1230,40 @@ UJsonFieldData * UJsonFieldData::SetNumberArray(const FString & key, const TArra
 		dataArray.Add(MakeShareable(new FJsonValueNumber(arrayData[i])));
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetArrayField(*key, dataArray);
 	return this;
 }
 
+/**
+* Adds the supplied 64-bit integer to the post data, under the given key
+*
+* @param	key						Key
+* @param	value					Integer
+*
+* @return	The object itself
+*/
+UJsonFieldData * UJsonFieldData::SetInteger(const FString & key, int64 value)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (HasData() && !key.IsEmpty()) {
+		if (!PrepareWrite()) {
+			return this;
+		}
+
+		// A double only holds integers up to 2^53 exactly, larger ones keep their literal
+		if (value > JsonNumber::MaxExactInteger || value < -JsonNumber::MaxExactInteger) {
+			Data->SetField(*key, MakeShared<FJsonValueNumberString>(LexToString(value)));
+		}
+		else {
+			Data->SetNumberField(*key, (double)value);
+		}
+	}
+	return this;
+}
+
 /**
 * Adds the supplied vector to the post data, under the given key
 *
@@ -585,11 +1274,15 @@ UJsonFieldData * UJsonFieldData::SetNumberArray(const FString & key, const TArra
 */
 UJsonFieldData * UJsonFieldData::SetVector(const FString & key, FVector value)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 	if (key.IsEmpty()) {
 		return this;
 	}
 
 	TSharedPtr<FJsonObject> JsonObject = CreateJSONVector(value);
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetObjectField(key, JsonObject);
 	return this;
 }
@@ -604,6 +1297,7 @@ UJsonFieldData * UJsonFieldData::SetVector(const FString & key, FVector value)
 */
 UJsonFieldData * UJsonFieldData::SetVectorArray(const FString & key, const TArray<FVector>& arrayData)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 
 	if (key.IsEmpty()) {
 		return this;
@@ -617,6 +1311,9 @@ UJsonFieldData * UJsonFieldData::SetVectorArray(const FString & key, const TArra
 		dataArray.Add(VectorValue);
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetArrayField(*key, dataArray);
 
 	return this;
@@ -632,11 +1329,15 @@ UJsonFieldData * UJsonFieldData::SetVectorArray(const FString & key, const TArra
 */
 UJsonFieldData * UJsonFieldData::SetColor(const FString & key, const FLinearColor& value)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 	if (key.IsEmpty()) {
 		return this;
 	}
 
 	TSharedPtr<FJsonObject> JsonObject = CreateJSONColor(value);
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetObjectField(key, JsonObject);
 	return this;
 }
@@ -652,11 +1353,15 @@ UJsonFieldData * UJsonFieldData::SetColor(const FString & key, const FLinearColo
 */
 UJsonFieldData * UJsonFieldData::SetRotator(const FString & key, FRotator value)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 	if (key.IsEmpty()) {
 		return this;
 	}
 
 	TSharedPtr<FJsonObject> JsonObject = CreateJSONRotator(value);
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetObjectField(key, JsonObject);
 	return this;
 }
@@ -671,12 +1376,16 @@ UJsonFieldData * UJsonFieldData::SetRotator(const FString & key, FRotator value)
 */
 UJsonFieldData * UJsonFieldData::SetTransform(const FString & key, FTransform value)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 
 	if (key.IsEmpty()) {
 		return this;
 	}
 
 	TSharedPtr<FJsonObject> JsonObject = CreateJSONTransform(value);
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->SetObjectField(key, JsonObject);
 
 	return this;
@@ -697,7 +1406,7 @@ UJsonFieldData* UJsonFieldData::GetObject(const FString& key) const
 
 	// Try to get the object field from the data
 	const TSharedPtr<FJsonObject> *outPtr;
-	if (!Data->TryGetObjectField(*key, outPtr)) {
+	if (!TryGetObjectField(FindField(key), outPtr)) {
 		// Throw an error and return NULL when the key could not be found
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Object is missing!"), *key);
 		return NULL;
@@ -706,42 +1415,58 @@ UJsonFieldData* UJsonFieldData::GetObject(const FString& key) const
 	// Create a new field data object and assign the data
 	fieldObj = UJsonFieldData::Create(contextObject);
 	fieldObj->Data = *outPtr;
+	fieldObj->LinkCopyOnWrite(this, key, INDEX_NONE);
 
 	// Return the newly created object
 	return fieldObj;
 }
 
-UClass * UJsonFieldData::GetClass(const FString & key) const
+/**
+* Gets the class whose path is stored under the key. Paths come from the document, so classes are only loaded when
+* asked for: use Get Class Field Async to load without blocking. Paths already resolved are cached.
+*
+* @param	key						Key
+* @param	bLoad					Load the class synchronously if it is not loaded yet
+*
+* @return	The class, null if missing, not loaded or not loadable
+*/
+UClass * UJsonFieldData::GetClass(const FString & key, bool bLoad) const
 {
 	FString classPath;
 	
 	// If the current post data isn't valid, return an empty string
-	if (!Data->TryGetStringField(*key, classPath)) {
+	if (!TryGetStringField(FindField(key), classPath)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Class is missing!"), *key);
 		return nullptr;
 	}
 	
-	//outClass = FindObjectChecked<UClass>(ANY_PACKAGE, *className);
-	//return FStringClassReference(classPath).TryLoadClass<UClass>();
-	return StaticLoadClass(UObject::StaticClass(), NULL, *classPath, NULL, LOAD_None, NULL);
+	return Cast<UClass>(bLoad ? JsonAssets::LoadSync(classPath, UClass::StaticClass()) : JsonAssets::FindLoaded(classPath));
 }
 
-TArray<UClass*> UJsonFieldData::GetClassArray(const FString & key) const
+/**
+* Gets the classes whose paths are stored under the key, see GetClass
+*
+* @param	key						Key
+* @param	bLoad					Load the classes which are not loaded yet synchronously
+*
+* @return	The classes, null for those which are not loaded or not loadable
+*/
+TArray<UClass*> UJsonFieldData::GetClassArray(const FString & key, bool bLoad) const
 {
 	TArray<UClass*> classArray;
 
 	// Try to get the array field from the post data
 	const TArray<TSharedPtr<FJsonValue>> *arrayPtr;
-	if (!Data->TryGetArrayField(*key, arrayPtr)) {
+	if (!TryGetArrayField(FindField(key), arrayPtr)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Class[] is missing!"), *key);
 		return classArray;
 	}
 	
 	// Iterate through the array and use the string value from all the entries
+	classArray.Reserve(arrayPtr->Num());
 	for (int32 i = 0; i < arrayPtr->Num(); i++) {
 		FString classPath = (*arrayPtr)[i]->AsString();
-		UClass* classInstance = StaticLoadClass(UObject::StaticClass(), NULL, *classPath, NULL, LOAD_None, NULL);
-		classArray.Add(classInstance);
+		classArray.Add(Cast<UClass>(bLoad ? JsonAssets::LoadSync(classPath, UClass::StaticClass()) : JsonAssets::FindLoaded(classPath)));
 	}
 
 	// Return the array, if unsuccessful the array will be empty
@@ -749,7 +1474,8 @@ TArray<UClass*> UJsonFieldData::GetClassArray(const FString & key) const
 }
 
 /**
-* Tries to get a string from the field data by key to use it like a data64 image buffer, returns the Texture2D when successful
+* Tries to get a string from the field data by key to use it like a data64 image buffer, returns the Texture2D when successful.
+* Textures are cached by content, an image already decoded is not decoded again while its texture is alive.
 *
 * @param	key			Key
 *
@@ -757,32 +1483,14 @@ TArray<UClass*> UJsonFieldData::GetClassArray(const FString & key) const
 */
 UTexture2D* UJsonFieldData::GetTexture(const FString& key) const
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 	FString Source;
-	TArray<uint8> data_buffer;
-	FString Left, Right;
-
-	if (!Data->TryGetStringField(key, Source)) {
+	if (!TryGetStringField(FindField(key), Source)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Texture2D is missing!"), *key);
 		return nullptr;
 	}
-	
-	Source.Split(TEXT(","), &Left, &Right);
-	if (Right.IsEmpty()) {
-		return nullptr;
-	}
 
-	bool isDecode = FBase64::Decode(Right, data_buffer);
-	if (!isDecode) {
-		return nullptr;
-	}
-
-	UTexture2D * Texture = FImageUtils::ImportBufferAsTexture2D(data_buffer);
-	//Texture->CompressionSettings = TextureCompressionSettings::TC_VectorDisplacementmap;
-	// Texture->MipGenSettings = TextureMipGenSettings::TMGS_NoMipmaps;
-	//Texture->SRGB = false;
-	Texture->Filter = TextureFilter::TF_Nearest;
-	Texture->UpdateResource();
-	return Texture;
+	return JsonTexture::Decode(Source);
 }
 
 /**
@@ -796,7 +1504,7 @@ FString UJsonFieldData::GetString(const FString& key) const {
 	FString outString;
 
 	// If the current post data isn't valid, return an empty string
-	if (!Data->TryGetStringField(key, outString)) {
+	if (!TryGetStringField(FindField(key), outString)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type String is missing!"), *key);
 		return "";
 	}
@@ -817,7 +1525,7 @@ TArray<FString> UJsonFieldData::GetStringArray(const FString& key) const
 
 	// Try to get the array field from the post data
 	const TArray<TSharedPtr<FJsonValue>> *arrayPtr;
-	if (!Data->TryGetArrayField(key, arrayPtr)) {
+	if (!TryGetArrayField(FindField(key), arrayPtr)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type String[] is missing!"), *key);
 		return stringArray;
 	}
@@ -837,7 +1545,7 @@ FName UJsonFieldData::GetName(const FString & key) const
 	FString str;
 
 	// If the current post data isn't valid, return an empty string
-	if (!Data->TryGetStringField(*key, str)) {
+	if (!TryGetStringField(FindField(key), str)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Name is missing!"), *key);
 		return "";
 	}
@@ -858,7 +1566,7 @@ TArray<FName> UJsonFieldData::GetNameArray(const FString & key) const
 
 	// Try to get the array field from the post data
 	const TArray<TSharedPtr<FJsonValue>> *arrayPtr;
-	if (!Data->TryGetArrayField(*key, arrayPtr)) {
+	if (!TryGetArrayField(FindField(key), arrayPtr)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Name[] is missing!"), *key);
 		return stringArray;
 	}
@@ -881,15 +1589,14 @@ TArray<FName> UJsonFieldData::GetNameArray(const FString & key) const
 */
 uint8 UJsonFieldData::GetByte(const FString & key) const
 {
-	uint32 outByte;
-
-	// If the current post data isn't valid, return an empty string
-	if (!Data->TryGetNumberField(*key, outByte)) {
-		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Byte is missing !"), *key);
-		return 0;
+	uint8 outByte;
+	const TSharedPtr<FJsonValue> value = FindField(key);
+	if (value.IsValid() && TryGetByte(*value, outByte)) {
+		return outByte;
 	}
 
-	return outByte;
+	UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Byte is missing !"), *key);
+	return 0;
 }
 
 /**
@@ -901,30 +1608,53 @@ uint8 UJsonFieldData::GetByte(const FString & key) const
 */
 TArray<uint8> UJsonFieldData::GetByteArray(const FString & key) const
 {
-	TArray<uint32> numberArray;
 	TArray<uint8> outArray;
 
 	// Try to get the array field from the post data
 	const TArray<TSharedPtr<FJsonValue>> *arrayPtr;
-	if (!Data->TryGetArrayField(*key, arrayPtr)) {
+	if (!TryGetArrayField(FindField(key), arrayPtr)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Byte[] is missing !"), *key);
 		return outArray;
 	}
 
-	// Iterate through the array and use the string value from all the entries
-	for (int32 i = 0; i < arrayPtr->Num(); i++) {
-		numberArray.Add((*arrayPtr)[i]->AsNumber());
+	// Iterate through the array and read the byte of every entry, 0 for entries which are not numbers
+	outArray.Reserve(arrayPtr->Num());
+	for (const TSharedPtr<FJsonValue>& item : *arrayPtr) {
+		uint8 byte = 0;
+		if (item.IsValid()) {
+			TryGetByte(*item, byte);
+		}
+		outArray.Add(byte);
 	}
 
-	outArray.Reset(numberArray.Num());
-	for (uint32 i : numberArray)
-	{
-		outArray.Add(i);
-	}
+	return outArray;
+}
 
+/**
+* Gets the bytes of a binary field, or of a string field holding base64 (standard or URL alphabet)
+*
+* @param	key						Key
+*
+* @return	The bytes, empty if the field is missing or is not base64
+*/
+TArray<uint8> UJsonFieldData::GetBinary(const FString& key) const
+{
+	TArray<uint8> outArray;
+	const TSharedPtr<FJsonValue> value = FindField(key);
+	if (!value.IsValid() || !FJsonValueBytes::TryGetBytes(*value, outArray)) {
+		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Binary is missing !"), *key);
+		outArray.Reset();
+	}
 	return outArray;
 }
 
+TConstArrayView<uint8> UJsonFieldData::ViewBinary(const FString& key) const
+{
+	const TSharedPtr<FJsonValue> value = FindField(key);
+	const FJsonValueBytes* bytes = value.IsValid() ? FJsonValueBytes::Cast(*value) : nullptr;
+	return bytes ? TConstArrayView<uint8>(bytes->GetBytes()) : TConstArrayView<uint8>();
+}
+
 /**
 * Gets a a Boolean for a given key
 *
@@ -935,13 +1665,14 @@ TArray<uint8> UJsonFieldData::GetByteArray(const FString & key) const
 bool UJsonFieldData::GetBool(const FString & key) const
 {
 
-	if (!Data.IsValid() || !Data->HasTypedField<EJson::Boolean>(key))
+	const TSharedPtr<FJsonValue> value = FindField(key);
+	if (!value.IsValid() || value->Type != EJson::Boolean)
 	{
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Boolean is missing !"), *key);
 		return false;
 	}
 
-	return Data->GetBoolField(key);
+	return value->AsBool();
 }
 
 /**
@@ -957,7 +1688,7 @@ TArray<bool> UJsonFieldData::GetBoolArray(const FString & key) const
 
 	// Try to get the array field from the post data
 	const TArray<TSharedPtr<FJsonValue>> *arrayPtr;
-	if (!Data->TryGetArrayField(*key, arrayPtr)) {
+	if (!TryGetArrayField(FindField(key), arrayPtr)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Boolean[] is missing !"), *key);
 		return boolArray;
 	}
@@ -979,10 +1710,10 @@ TArray<bool> UJsonFieldData::GetBoolArray(const FString & key) const
 */
 float UJsonFieldData::GetNumber(const FString & key) const
 {
-	double outNumber;
+	double outNumber = 0;
 
 	// If the current post data isn't valid, return an empty string
-	if (!Data->TryGetNumberField(*key, outNumber)) {
+	if (!TryGetNumberField(FindField(key), outNumber)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Number is missing !"), *key);
 	}
 
@@ -998,22 +1729,71 @@ float UJsonFieldData::GetNumber(const FString & key) const
 */
 TArray<float> UJsonFieldData::GetNumberArray(const FString & key) const
 {
-	TArray<float> numberArray;
+	TArray<float> numberArray;
+
+	// Try to get the array field from the post data
+	const TArray<TSharedPtr<FJsonValue>> *arrayPtr;
+	if (TryGetArrayField(FindField(key), arrayPtr)) {
+		// Iterate through the array and use the string value from all the entries
+		for (int32 i = 0; i < arrayPtr->Num(); i++) {
+			numberArray.Add((*arrayPtr)[i]->AsNumber());
+		}
+	}
+	else {
+		// Throw an error when the entry could not be found in the field data
+		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Number[] is missing !"), *key);
+	}
+
+	return numberArray;
+}
+
+/**
+* Gets an exact 64-bit integer for a given key
+*
+* @param	key						Key
+*
+* @return	Integer, 0 if missing or not an integer
+*/
+int64 UJsonFieldData::GetInteger(const FString & key) const
+{
+	int64 outInteger = 0;
+
+	const TSharedPtr<FJsonValue> value = FindField(key);
+	if (!value.IsValid() || !JsonNumber::TryGetInteger(*value, outInteger)) {
+		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Integer is missing !"), *key);
+		return 0;
+	}
+
+	return outInteger;
+}
+
+/**
+* Gets an array of exact 64-bit integers for a given key
+*
+* @param	key						Key
+*
+* @return	Array of Integer, entries which are not integers are 0
+*/
+TArray<int64> UJsonFieldData::GetInteger64Array(const FString & key) const
+{
+	TArray<int64> integerArray;
 
-	// Try to get the array field from the post data
 	const TArray<TSharedPtr<FJsonValue>> *arrayPtr;
-	if (Data->TryGetArrayField(*key, arrayPtr)) {
-		// Iterate through the array and use the string value from all the entries
-		for (int32 i = 0; i < arrayPtr->Num(); i++) {
-			numberArray.Add((*arrayPtr)[i]->AsNumber());
-		}
+	if (!TryGetArrayField(FindField(key), arrayPtr)) {
+		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Integer[] is missing !"), *key);
+		return integerArray;
 	}
-	else {
-		// Throw an error when the entry could not be found in the field data
-		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Number[] is missing !"), *key);
+
+	integerArray.Reserve(arrayPtr->Num());
+	for (const TSharedPtr<FJsonValue>& item : *arrayPtr) {
+		int64 value = 0;
+		if (item.IsValid()) {
+			JsonNumber::TryGetInteger(*item, value);
+		}
+		integerArray.Add(value);
 	}
 
-	return numberArray;
+	return integerArray;
 }
 
 /**
@@ -1026,14 +1806,33 @@ TArray<float> UJsonFieldData::GetNumberArray(const FString & key) const
 TArray<UJsonFieldData*> UJsonFieldData::GetObjectArray(const FString& key) const
 {
 	TArray<UJsonFieldData*> objectArray;
+	const TSharedPtr<FJsonValue> field = FindField(key);
+
+	// The views of a flat record array read their record in place, its objects are only built by a write
+	const FJsonValueRecordArray* records = field.IsValid() ? FJsonValueRecordArray::Cast(*field) : nullptr;
+	const TSharedPtr<const FJsonValueRecordArray::FSlots> flat = records ? records->PinSlots() : nullptr;
+	if (flat.IsValid()) {
+		const TSharedPtr<const FJsonValueRecordArray> shared = StaticCastSharedPtr<const FJsonValueRecordArray>(field);
+		objectArray.Reserve(records->Num());
+		for (int32 i = 0; i < records->Num(); i++) {
+			UJsonFieldData* pageData = Create(contextObject);
+			pageData->Data.Reset();
+			pageData->Records = shared;
+			pageData->RecordSlots = flat;
+			pageData->LinkCopyOnWrite(this, key, i);
+			objectArray.Add(pageData);
+		}
+		return objectArray;
+	}
 
 	// Try to fetch and assign the array to the array pointer
 	const TArray<TSharedPtr<FJsonValue>> *arrayPtr;
-	if (Data->TryGetArrayField(*key, arrayPtr)) {
+	if (TryGetArrayField(field, arrayPtr)) {
 		// Iterate through the input array and create new post data objects for every entry and add them to the objectArray
 		for (int32 i = 0; i < arrayPtr->Num(); i++) {
 			UJsonFieldData* pageData = Create(contextObject);
 			pageData->Data = (*arrayPtr)[i]->AsObject();
+			pageData->LinkCopyOnWrite(this, key, i);
 			objectArray.Add(pageData);
 		}
 	}
@@ -1053,7 +1852,7 @@ FTransform UJsonFieldData::GetTransform(const FString & key) const
 
 	const TSharedPtr<FJsonObject> *JsonObject;
 
-	if (!Data->TryGetObjectField(key, JsonObject))
+	if (!TryGetObjectField(FindField(key), JsonObject))
 	{
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Transform is missing !"), *key);
 		return outTransform;
@@ -1114,7 +1913,7 @@ FRotator UJsonFieldData::GetRotator(const FString & key) const
 
 	// Try to get the array field from the post data
 	const TSharedPtr<FJsonObject> *JsonObject;
-	if (!Data->TryGetObjectField(*key, JsonObject)) {
+	if (!TryGetObjectField(FindField(key), JsonObject)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Rotator[] is missing !"), *key);
 		return FRotator();
 	}
@@ -1130,18 +1929,19 @@ FRotator UJsonFieldData::GetRotator(const FString & key) const
 */
 FLinearColor UJsonFieldData::GetColor(const FString & key) const
 {
-	if (Data->HasTypedField<EJson::Object>(key)) {
+	const TSharedPtr<FJsonValue> value = FindField(key);
+	if (value.IsValid() && value->Type == EJson::Object) {
 		const TSharedPtr<FJsonObject>* JsonObject;
-		if (!Data->TryGetObjectField(*key, JsonObject)) {
+		if (!value->TryGetObject(JsonObject)) {
 			UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type LinearColor is missing !"), *key);
 				return FLinearColor();
 		}
 		return CreateColor(*JsonObject);
 	}
 
-	if (Data->HasTypedField<EJson::String>(key)) {
+	if (value.IsValid() && value->Type == EJson::String) {
 		FString StrColor;
-		if (Data->TryGetStringField(*key, StrColor)) {
+		if (value->TryGetString(StrColor)) {
 			const auto Color = FColor::FromHex(StrColor);
 			return FLinearColor(Color);
 		}
@@ -1154,7 +1954,7 @@ TArray<FLinearColor> UJsonFieldData::GetColorArray(const FString & key) const
 {
 	TArray<FLinearColor> OutColorArray;
 	const TSharedPtr<FJsonObject> * ArrayObject;
-	if (Data->TryGetObjectField(*key, ArrayObject))
+	if (TryGetObjectField(FindField(key), ArrayObject))
 	{
 		for (auto iKey = (*ArrayObject)->Values.CreateConstIterator(); iKey; ++iKey)
 		{
@@ -1182,7 +1982,7 @@ FVector UJsonFieldData::GetVector(const FString & key) const
 {
 	// Try to get the array field from the post data
 	const TSharedPtr<FJsonObject> *JsonObject;
-	if (!Data->TryGetObjectField(*key, JsonObject)) {
+	if (!TryGetObjectField(FindField(key), JsonObject)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type LinearColor[] is missing !"), *key);
 		return FVector();
 	}
@@ -1201,7 +2001,7 @@ TArray<FVector> UJsonFieldData::GetVectorArray(const FString & key) const
 	TArray<FVector> OutVectorArray;
 
 	const TSharedPtr<FJsonObject> * ArrayObject;
-	if (!Data->TryGetObjectField(*key, ArrayObject)) {
+	if (!TryGetObjectField(FindField(key), ArrayObject)) {
 		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type String is missing !"), *key);
 		return OutVectorArray;
 	}
@@ -1213,6 +2013,198 @@ TArray<FVector> UJsonFieldData::GetVectorArray(const FString & key) const
 
 	return OutVectorArray;
 }
+/**
+* Gets a Number field from every object of an array
+*
+* @param	key						Key of the array
+* @param	field					Field to read in every object
+*
+* @return	Array of Number, 0 where the field is missing
+*/
+TArray<float> UJsonFieldData::GetColumnNumber(const FString& key, const FString& field) const
+{
+	TArray<FJsonColumn> columns = { FJsonColumn(field, EJsonColumnType::Number) };
+	ReadColumns(ReadObject(), key, columns);
+	return MoveTemp(columns[0].Numbers);
+}
+
+/**
+* Gets a String field from every object of an array
+*
+* @param	key						Key of the array
+* @param	field					Field to read in every object
+*
+* @return	Array of String, empty where the field is missing
+*/
+TArray<FString> UJsonFieldData::GetColumnString(const FString& key, const FString& field) const
+{
+	TArray<FJsonColumn> columns = { FJsonColumn(field, EJsonColumnType::String) };
+	ReadColumns(ReadObject(), key, columns);
+	return MoveTemp(columns[0].Strings);
+}
+
+/**
+* Gets a Bool field from every object of an array
+*
+* @param	key						Key of the array
+* @param	field					Field to read in every object
+*
+* @return	Array of Booleans, false where the field is missing
+*/
+TArray<bool> UJsonFieldData::GetColumnBool(const FString& key, const FString& field) const
+{
+	TArray<FJsonColumn> columns = { FJsonColumn(field, EJsonColumnType::Bool) };
+	ReadColumns(ReadObject(), key, columns);
+	return MoveTemp(columns[0].Bools);
+}
+
+/**
+* Gets a Vector field from every object of an array
+*
+* @param	key						Key of the array
+* @param	field					Field to read in every object
+*
+* @return	Array of FVectors, default where the field is missing
+*/
+TArray<FVector> UJsonFieldData::GetColumnVector(const FString& key, const FString& field) const
+{
+	TArray<FJsonColumn> columns = { FJsonColumn(field, EJsonColumnType::Vector) };
+	ReadColumns(ReadObject(), key, columns);
+	return MoveTemp(columns[0].Vectors);
+}
+
+/**
+* Gets several fields from every object of an array in a single pass
+*
+* @param	key						Key of the array
+* @param	columns					Field and Type of each column to read
+*
+* @return	The columns with the array matching their Type filled
+*/
+TArray<FJsonColumn> UJsonFieldData::GetColumns(const FString& key, const TArray<FJsonColumn>& columns) const
+{
+	TArray<FJsonColumn> outColumns;
+	outColumns.Reserve(columns.Num());
+	for (const FJsonColumn& column : columns) {
+		outColumns.Emplace(column.Field, column.Type);
+	}
+
+	ReadColumns(ReadObject(), key, outColumns);
+	return outColumns;
+}
+
+/**
+* Fills the columns from the objects of an array. Every column gets one entry per element, elements which are not
+* objects or lack the field give a default value. Record arrays are read in place through their shape, the field is
+* looked up once per column instead of once per element.
+*
+* @param	Object					Object holding the array
+* @param	Key						Key of the array
+* @param	Columns					Field and Type of each column, their values are replaced
+*
+* @return	False if the array is missing
+*/
+bool UJsonFieldData::ReadColumns(const TSharedPtr<FJsonObject>& Object, const FString& Key, TArray<FJsonColumn>& Columns)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+
+	for (FJsonColumn& Column : Columns) {
+		Column.Numbers.Reset();
+		Column.Strings.Reset();
+		Column.Bools.Reset();
+		Column.Vectors.Reset();
+	}
+
+	const TSharedPtr<FJsonValue> ArrayValue = Object.IsValid() ? Object->TryGetField(Key) : TSharedPtr<FJsonValue>();
+	if (!ArrayValue.IsValid() || ArrayValue->Type != EJson::Array) {
+		UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Object[] is missing !"), *Key);
+		return false;
+	}
+
+	const FJsonValueRecordArray* Records = FJsonValueRecordArray::Cast(*ArrayValue);
+	const TSharedPtr<const FJsonValueRecordArray::FSlots> Flat = Records ? Records->PinSlots() : nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* Elements = nullptr;
+	if (!Flat.IsValid()) {
+		Records = nullptr;
+		ArrayValue->TryGetArray(Elements);
+	}
+	const int32 Num = Records ? Records->Num() : Elements->Num();
+
+	for (FJsonColumn& Column : Columns) {
+		switch (Column.Type) {
+		case EJsonColumnType::Number: Column.Numbers.SetNumUninitialized(Num); break;
+		case EJsonColumnType::String: Column.Strings.SetNum(Num); break;
+		case EJsonColumnType::Bool: Column.Bools.SetNumUninitialized(Num); break;
+		case EJsonColumnType::Vector: Column.Vectors.SetNumUninitialized(Num); break;
+		}
+	}
+
+	// Slot of each column in the record shape
+	TArray<int32, TInlineAllocator<8>> Slots;
+	if (Records) {
+		for (const FJsonColumn& Column : Columns) {
+			Slots.Add(Records->GetShape().Find(Column.Field));
+		}
+	}
+
+	for (int32 Index = 0; Index < Num; ++Index) {
+		const TSharedPtr<FJsonValue>* Record = Records ? Records->GetRecord(*Flat, Index) : nullptr;
+		const FJsonObject* Element = nullptr;
+		if (!Records) {
+			const TSharedPtr<FJsonValue>& Item = (*Elements)[Index];
+			const TSharedPtr<FJsonObject>* ItemObject;
+			if (Item.IsValid() && Item->TryGetObject(ItemObject)) {
+				Element = ItemObject->Get();
+			}
+		}
+
+		for (int32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ++ColumnIndex) {
+			FJsonColumn& Column = Columns[ColumnIndex];
+
+			const FJsonValue* Value = nullptr;
+			if (Record) {
+				const int32 Slot = Slots[ColumnIndex];
+				Value = Slot != INDEX_NONE ? Record[Slot].Get() : nullptr;
+			}
+			else if (Element) {
+				const TSharedPtr<FJsonValue>* Field = Element->Values.Find(Column.Field);
+				Value = Field ? Field->Get() : nullptr;
+			}
+
+			switch (Column.Type) {
+			case EJsonColumnType::Number: {
+				double Number = 0;
+				if (Value) {
+					Value->TryGetNumber(Number);
+				}
+				Column.Numbers[Index] = Number;
+				break;
+			}
+			case EJsonColumnType::String:
+				if (Value) {
+					Value->TryGetString(Column.Strings[Index]);
+				}
+				break;
+			case EJsonColumnType::Bool: {
+				bool bValue = false;
+				if (Value) {
+					Value->TryGetBool(bValue);
+				}
+				Column.Bools[Index] = bValue;
+				break;
+			}
+			case EJsonColumnType::Vector: {
+				const TSharedPtr<FJsonObject>* VectorObject;
+				Column.Vectors[Index] = Value && Value->TryGetObject(VectorObject) ? CreateVector(*VectorObject) : FVector();
+				break;
+			}
+			}
+		}
+	}
+
+	return true;
+}
+
 /**
 * Gets the keys from the supplied object
 *
@@ -1224,7 +2216,12 @@ TArray<FString> UJsonFieldData::GetObjectKeys() const
 {
 	TArray<FString> stringArray;
 
-	for (auto currJsonValue = Data->Values.CreateConstIterator(); currJsonValue; ++currJsonValue) {
+	const TSharedPtr<FJsonObject> object = ReadObject();
+	if (!object.IsValid()) {
+		return stringArray;
+	}
+
+	for (auto currJsonValue = object->Values.CreateConstIterator(); currJsonValue; ++currJsonValue) {
 		stringArray.Add((*currJsonValue).Key);
 	}
 
@@ -1239,7 +2236,7 @@ TArray<FString> UJsonFieldData::GetObjectKeys() const
 */
 bool UJsonFieldData::HasKey(const FString& key) const
 {
-	return Data->HasField(key);
+	return FindField(key).IsValid();
 }
 
 
@@ -1252,7 +2249,7 @@ bool UJsonFieldData::HasAllKeys(const TArray<FString>& keys) const
 {
 	bool check = true;
 	for (auto k = keys.CreateConstIterator(); k; ++k) {
-		if (!Data->HasField(*k)) {
+		if (!FindField(*k).IsValid()) {
 			check = false;
 			break;
 		}
@@ -1267,42 +2264,405 @@ bool UJsonFieldData::HasAllKeys(const TArray<FString>& keys) const
 */
 UJsonFieldData* UJsonFieldData::RemoveKey(const FString& key)
 {
-	if (!Data.IsValid() || key.IsEmpty()) {
+	if (!HasData() || key.IsEmpty()) {
 		return this;
 	}
 
+	if (!PrepareWrite()) {
+		return this;
+	}
 	Data->RemoveField(key);
 	return this;
 }
 
+/**
+* Creates an independent copy of the data. In copy-on-write mode the copy shares every object and both sides
+* clone what they write, otherwise the objects are deep copied right away.
+*
+* @return	The copy, NULL if the data is invalid
+*/
 UJsonFieldData* UJsonFieldData::Copy()
 {
-	if (!Data.IsValid()) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	const TSharedPtr<FJsonObject> object = ReadObject();
+	if (!object.IsValid()) {
 		return NULL;
 	}
 
-	const auto Content = GetContentString();
-	return FromString(Content);
+	const bool bShare = IsCopyOnWrite() || IsFrozen();
+	UJsonFieldData* copy = CreateFromJson(contextObject, bShare ? object : DeepClone(object), bShare);
+	copy->MaxDecimals = MaxDecimals;
+	copy->bObjectGraph = bObjectGraph;
+
+	// The objects of this document are shared from now on
+	if (bShare) {
+		Cow->Disown();
+	}
+
+	return copy;
+}
+
+/**
+* Deep copy of a JSON object
+*
+* @param	Object		The object to copy
+*
+* @return	The copy, null if the object is invalid
+*/
+TSharedPtr<FJsonObject> UJsonFieldData::DeepClone(const TSharedPtr<FJsonObject>& Object)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	return Object.IsValid() ? CloneObject(*Object) : TSharedPtr<FJsonObject>();
+}
+
+/**
+* Enables copy-on-write for this JSON and every view read from it
+*
+* @param	bEnabled		Clone shared objects on write instead of writing through
+*
+* @return	This
+*/
+UJsonFieldData* UJsonFieldData::SetCopyOnWrite(bool bEnabled)
+{
+	if (!Cow.IsValid()) {
+		if (!bEnabled) {
+			return this;
+		}
+		Cow = MakeShared<FJsonCowState>();
+	}
+
+	// Objects already stored may be shared, they are cloned on their first write
+	if (bEnabled != Cow->bEnabled) {
+		Cow->Disown();
+		Cow->bEnabled = bEnabled;
+	}
+	return this;
+}
+
+bool UJsonFieldData::IsCopyOnWrite() const
+{
+	return Cow.IsValid() && Cow->bEnabled;
+}
+
+/**
+* Publishes the current content as an immutable snapshot. The document switches to copy-on-write, so the writes
+* which follow clone the objects on their path and the snapshot keeps every object it saw unchanged.
+*
+* @return	The snapshot, sharing its objects with the document and with the previous snapshots
+*/
+FJsonSnapshot UJsonFieldData::Snapshot()
+{
+	SetCopyOnWrite(true);
+
+	// Nothing is owned any more, the next write clones its path: O(depth), not O(document)
+	Cow->Disown();
+	if (Cow->bChangedSinceSnapshot) {
+		Cow->Version++;
+		Cow->bChangedSinceSnapshot = false;
+	}
+
+	return FJsonSnapshot(ReadObject(), Cow->Version);
+}
+
+/**
+* Creates a read-only JSON of the current content, later writes to this JSON do not reach it
+*
+* @return	The frozen JSON
+*/
+UJsonFieldData* UJsonFieldData::Freeze()
+{
+	return CreateFromSnapshot(contextObject, Snapshot());
+}
+
+bool UJsonFieldData::IsFrozen() const
+{
+	return Cow.IsValid() && Cow->bFrozen;
+}
+
+/**
+* Create a read-only JSON viewing a snapshot, for use in Blueprint graphs
+*
+* @param	WorldContextObject		The current context
+* @param	Snapshot				Snapshot to view
+*
+* @return	The frozen JSON
+*/
+UJsonFieldData* UJsonFieldData::CreateFromSnapshot(UObject* WorldContextObject, const FJsonSnapshot& Snapshot)
+{
+	UJsonFieldData* Json = CreateFromJson(WorldContextObject, ConstCastSharedPtr<FJsonObject>(Snapshot.GetRoot()));
+	Json->Cow = MakeShared<FJsonCowState>();
+	Json->Cow->bFrozen = true;
+	return Json;
+}
+
+/**
+* Gets this view ready for a write. Frozen JSON refuses it. In copy-on-write mode, the objects on the path to this
+* view which the document does not own yet are cloned, so that the write does not reach any other document or
+* snapshot: the parent is prepared first and the clone is stored in it.
+*
+* @return	False if the write must not happen
+*/
+bool UJsonFieldData::PrepareWrite()
+{
+	if (!Cow.IsValid()) {
+		return true;
+	}
+
+	if (Cow->bFrozen) {
+		UE_LOG(LogJson, Warning, TEXT("JSON is frozen, the write is ignored"));
+		return false;
+	}
+
+	Cow->bChangedSinceSnapshot = true;
+	ResolveData();
+	if (!Cow->bEnabled || !Data.IsValid() || Cow->IsOwned(Data)) {
+		return true;
+	}
+
+	LLM_SCOPE_BYTAG(JSONParser);
+
+	if (CowParent) {
+		CowParent->PrepareWrite();
+
+		// Follow the object currently stored in the parent, another view may have cloned it already
+		const TSharedPtr<FJsonObject> current = CowParent->FindCowChild(CowKey, CowIndex);
+		if (!current.IsValid()) {
+			CowParent = nullptr;
+		}
+		else {
+			Data = current;
+			if (Cow->IsOwned(Data)) {
+				return true;
+			}
+		}
+	}
+
+	// Shallow clone, the children stay shared until they are written themselves
+	TSharedPtr<FJsonObject> clone = MakeShared<FJsonObject>();
+	clone->Values = Data->Values;
+	Cow->Own(clone);
+	Data = clone;
+
+	if (!CowParent) {
+		return true;
+	}
+
+	if (CowIndex == INDEX_NONE) {
+		CowParent->Data->SetObjectField(CowKey, clone);
+		return true;
+	}
+
+	// The array is copied on the first element write of the epoch only, the next ones replace their element in place
+	TSharedPtr<FJsonValue> array = CowParent->Data->TryGetField(CowKey);
+	if (!array.IsValid() || !Cow->IsOwned(array)) {
+		const TArray<TSharedPtr<FJsonValue>>* elements;
+		if (!array.IsValid() || !array->TryGetArray(elements)) {
+			return true;
+		}
+		array = MakeShared<FJsonValueArray>(*elements);
+		Cow->Own(array);
+		CowParent->Data->SetField(CowKey, array);
+	}
+	JsonValueType::GetMutableArray(*array)[CowIndex] = MakeShared<FJsonValueObject>(clone);
+	return true;
+}
+
+/**
+* Links a view read from Parent to it, so that it follows the copy-on-write and frozen state of the parent document
+*
+* @param	Parent		View the object was read from
+* @param	Key			Field of the object in the parent
+* @param	Index		Element of the array field, INDEX_NONE for an object field
+*/
+void UJsonFieldData::LinkCopyOnWrite(const UJsonFieldData* Parent, const FString& Key, int32 Index)
+{
+	// Views are linked even before copy-on-write is enabled, a later snapshot must not be written through them
+	UJsonFieldData* parent = const_cast<UJsonFieldData*>(Parent);
+	if (!parent->Cow.IsValid()) {
+		parent->Cow = MakeShared<FJsonCowState>();
+	}
+
+	Cow = parent->Cow;
+	CowParent = parent;
+	CowKey = Key;
+	CowIndex = Index;
+	MaxDecimals = Parent->MaxDecimals;
+	bObjectGraph = Parent->bObjectGraph;
+}
+
+TSharedPtr<FJsonObject> UJsonFieldData::FindCowChild(const FString& Key, int32 Index) const
+{
+	const TSharedPtr<FJsonValue> field = Data->TryGetField(Key);
+	if (!field.IsValid()) {
+		return nullptr;
+	}
+
+	const TSharedPtr<FJsonObject>* object;
+	if (Index == INDEX_NONE) {
+		return field->TryGetObject(object) ? *object : TSharedPtr<FJsonObject>();
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* elements;
+	if (!field->TryGetArray(elements) || !elements->IsValidIndex(Index) || !(*elements)[Index].IsValid()) {
+		return nullptr;
+	}
+	return (*elements)[Index]->TryGetObject(object) ? *object : TSharedPtr<FJsonObject>();
+}
+
+bool UJsonFieldData::HasData() const
+{
+	return Data.IsValid() || Records.IsValid();
+}
+
+/**
+* Gives a record view the object of its record, so that it can be written like any other view. The record array
+* builds the objects of all its records at once, the other views of the array follow them from then on.
+*
+* @return	Whether Data is valid
+*/
+bool UJsonFieldData::ResolveData()
+{
+	if (Records.IsValid()) {
+		Data = ReadObject();
+		Records.Reset();
+		RecordSlots.Reset();
+	}
+	return Data.IsValid();
+}
+
+/**
+* Finds a field of this view. A record view reads it from the slots of its record through the shape of the array,
+* until the array builds its objects.
+*
+* @param	Key			Key
+*
+* @return	The value, null if the field is missing
+*/
+TSharedPtr<FJsonValue> UJsonFieldData::FindField(const FString& Key) const
+{
+	if (Records.IsValid() && Records->IsFlat()) {
+		const int32 Slot = Records->GetShape().Find(Key);
+		return Slot != INDEX_NONE ? Records->GetRecord(*RecordSlots, CowIndex)[Slot] : TSharedPtr<FJsonValue>();
+	}
+
+	const TSharedPtr<FJsonObject> Object = ReadObject();
+	return Object.IsValid() ? Object->TryGetField(Key) : TSharedPtr<FJsonValue>();
+}
+
+const FJsonValue* UJsonFieldData::FindKey(const FJsonKey& Key) const
+{
+	// The shape hashes its keys like the fields of an object, the precomputed hash applies to both
+	if (Records.IsValid() && Records->IsFlat()) {
+		const int32* Slot = Records->GetShape().Slots.FindByHash(Key.Hash, Key.Name);
+		return Slot ? Records->GetRecord(*RecordSlots, CowIndex)[*Slot].Get() : nullptr;
+	}
+
+	const TSharedPtr<FJsonObject> Object = ReadObject();
+	return Object.IsValid() ? JsonAccess::Find(*Object, Key) : nullptr;
+}
+
+/**
+* The object this JSON views. For a record view it is a new object sharing the values of the record while the array
+* is flat, and the object the array built for the record afterwards.
+*
+* @return	The object, null if there is none
+*/
+TSharedPtr<FJsonObject> UJsonFieldData::ReadObject() const
+{
+	if (!Records.IsValid()) {
+		return Data;
+	}
+
+	if (Records->IsFlat()) {
+		return FJsonValueRecordArray::MakeObject(Records->GetShape(), Records->GetRecord(*RecordSlots, CowIndex));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* elements;
+	Records->TryGetArray(elements);
+	return (*elements)[CowIndex]->AsObject();
+}
+
+/**
+* Object of another JSON to store in this one. It is shared when both JSON clone on write, and stored as is when
+* neither does, so that both write to it. Otherwise it is deep copied: a JSON writing in place must not reach
+* the objects of a copy-on-write document or of a snapshot.
+*/
+TSharedPtr<FJsonObject> UJsonFieldData::ShareObject(const UJsonFieldData* Source) const
+{
+	const bool bSourceShared = Source->IsCopyOnWrite() || Source->IsFrozen();
+	if (!IsCopyOnWrite()) {
+		if (bSourceShared) {
+			return DeepClone(Source->ReadObject());
+		}
+
+		// Both write in place, a record view is written through the object of its record
+		const_cast<UJsonFieldData*>(Source)->ResolveData();
+		return Source->Data;
+	}
+
+	if (!bSourceShared) {
+		return DeepClone(Source->ReadObject());
+	}
+
+	// The source must clone before its next write
+	Source->Cow->Disown();
+	return Source->ReadObject();
+}
+
+void UJsonFieldData::OnDataReplaced()
+{
+	Records.Reset();
+	RecordSlots.Reset();
+
+	if (Cow.IsValid() && Data.IsValid()) {
+		CowParent = nullptr;
+		Cow->bChangedSinceSnapshot = true;
+		if (Cow->bEnabled) {
+			Cow->Own(Data);
+		}
+	}
+}
+
+/**
+* Creates new data from a given string
+*
+* @param	string			dataString
+*
+* @return	The requested JsonObject (this), empty if failed
+*/
+UJsonFieldData* UJsonFieldData::FromString(const FString& dataString) {
+	return ReadString(dataString, nullptr);
 }
 
 /**
-* Creates new data from a given string
+* Creates new data from the given fields of a string, the other fields are skipped without being built
 *
-* @param	string			dataString
+* @param	dataString		The JSON string
+* @param	Fields			Paths of the fields to keep, names separated by dots, * matches any name
 *
 * @return	The requested JsonObject (this), empty if failed
 */
-UJsonFieldData* UJsonFieldData::FromString(const FString& dataString) {
-	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(dataString);
+UJsonFieldData* UJsonFieldData::FromStringProjected(const FString& dataString, const TArray<FString>& Fields) {
+	const FJsonProjection Projection(Fields);
+	return ReadString(dataString, &Projection);
+}
+
+UJsonFieldData* UJsonFieldData::ReadString(const FString& dataString, const FJsonProjection* Projection) {
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (IsFrozen()) {
+		UE_LOG(LogJson, Warning, TEXT("JSON is frozen, the write is ignored"));
+		return this;
+	}
 
 	if (!dataString.Len()) {
 		UE_LOG(LogJson, Warning, TEXT("JSON data is Empty"), *dataString);
 	}
 
 	// Deserialize the JSON data
-	bool isDeserialized = FJsonSerializer::Deserialize(JsonReader, Data);
+	bool isDeserialized = DeserializeObject(dataString, Data, Projection);
+	OnDataReplaced();
 
-	if (!isDeserialized || !Data.IsValid()) {
+	if (!isDeserialized) {
 		UE_LOG(LogJson, Warning, TEXT("JSON data is invalid! Input:\n'%s'"), *dataString);
 	}
 
@@ -1319,16 +2679,11 @@ UJsonFieldData* UJsonFieldData::FromString(const FString& dataString) {
 */
 UJsonFieldData * UJsonFieldData::FromCompressed(const TArray<uint8>& CompressedData,bool& bIsValid)
 {
-	TArray<TCHAR> UncompressedData;
-	
-	int32 UncompressedSize;
-	FMemory::Memcpy(&UncompressedSize, &CompressedData[0], sizeof(UncompressedSize));
-	UncompressedData.SetNum(UncompressedSize);
-	bIsValid = FCompression::UncompressMemory(TEXT("ZLIB"), UncompressedData.GetData(), UncompressedSize, CompressedData.GetData() + sizeof(UncompressedSize), CompressedData.Num() - sizeof(UncompressedSize));
+	LLM_SCOPE_BYTAG(JSONParser);
+	FString StringData;
+	bIsValid = UncompressString(CompressedData, StringData);
 
 	if (bIsValid) {
-		FString StringData = FString(UncompressedSize / sizeof(TCHAR), UncompressedData.GetData());
-
 		FromString(StringData);
 	}
 	
@@ -1336,6 +2691,28 @@ UJsonFieldData * UJsonFieldData::FromCompressed(const TArray<uint8>& CompressedD
 	return this;
 }
 
+/**
+* Creates new data from the compact binary format
+*
+* @param	BinaryData		Binary document
+* @param	isValid			OUT Validity of operation
+*
+* @return	This
+*/
+UJsonFieldData* UJsonFieldData::FromBinary(const TArray<uint8>& BinaryData, bool& bIsValid)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (IsFrozen()) {
+		UE_LOG(LogJson, Warning, TEXT("JSON is frozen, the write is ignored"));
+		bIsValid = false;
+		return this;
+	}
+
+	bIsValid = FJsonBinary::Read(BinaryData, Data);
+	OnDataReplaced();
+	return this;
+}
+
 /**
 * Serialize a giver UObject into Json Object
 *
@@ -1347,35 +2724,130 @@ UJsonFieldData * UJsonFieldData::FromCompressed(const TArray<uint8>& CompressedD
 */
 UObject* UJsonFieldData::GetUObjectField(const FString & Key, UObject* Context, bool& Success)
 {
+	LLM_SCOPE_BYTAG(JSONParser);
 	check(Context);
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonJsonToProperty);
 
-	TSharedPtr<FJsonObject> JsonObject = Data->GetObjectField(Key);
-	for (auto currJsonValue = JsonObject->Values.CreateConstIterator(); currJsonValue; ++currJsonValue) {
-
-		TSharedPtr<FJsonValue> Value = (*currJsonValue).Value;
-		const FString ValueKey = (*currJsonValue).Key;
+	const TSharedPtr<FJsonObject>* JsonObjectPtr;
+	if (!TryGetObjectField(FindField(Key), JsonObjectPtr) || !JsonObjectPtr->IsValid()) {
+		Success = false;
+		return Context;
+	}
+	const FJsonObject& JsonObject = **JsonObjectPtr;
 
-		FProperty* FoundProperty = FindFProperty<FProperty>(Context->GetClass(), *ValueKey);
-		void* PropertyData = FoundProperty->ContainerPtrToValuePtr<uint8>(Context);
-		
-		if (FoundProperty)
-		{
-			SetJsonValueIntoProperty(Value, FoundProperty, PropertyData);
-		}
+	// Object graph, the context is the first object of the table
+	const TArray<TSharedPtr<FJsonValue>>* Table;
+	if (JsonObject.TryGetArrayField(TEXT("$objects"), Table)) {
+		FJsonObjectGraphReader Graph(*Table, Context);
+		TGuardValue<FJsonObjectGraphReader*> ActiveGraph(FJsonObjectGraphReader::Active, &Graph);
+		Success = Graph.Resolve(0, Context->GetClass(), Context, &SetJsonObjectIntoUObject) == Context;
+		return Context;
 	}
+
+	SetJsonObjectIntoUObject(JsonObject, Context);
 	Success = true;
 
 	return Context;
 }
 
+/**
+* Adds the value of any property to the post data, called by the SetAnyProperty thunk
+*
+* @param	Key				Key
+* @param	Property		The property describing the value
+* @param	PropertyData	Pointer to the value
+*/
+void UJsonFieldData::SetAnyPropertyInternal(const FString& Key, const FProperty* Property, const void* PropertyData)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!HasData() || !Property || !PropertyData) {
+		return;
+	}
+
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonPropertyToJson);
+	if (!PrepareWrite()) {
+		return;
+	}
+
+	if (!bObjectGraph) {
+		Data->SetField(Key, GetJsonValue(Property, PropertyData));
+		return;
+	}
+
+	// The value goes next to the table of the objects it references, when there are any
+	FJsonObjectGraphWriter Graph;
+	TSharedPtr<FJsonValue> Value;
+	{
+		TGuardValue<FJsonObjectGraphWriter*> ActiveGraph(FJsonObjectGraphWriter::Active, &Graph);
+		Value = GetJsonValue(Property, PropertyData);
+	}
+
+	if (Graph.Objects.Num() == 0) {
+		Data->SetField(Key, Value);
+		return;
+	}
+
+	TSharedPtr<FJsonObject> JsonGraph = MakeShared<FJsonObject>();
+	JsonGraph->SetField(TEXT("$value"), Value);
+	JsonGraph->SetArrayField(TEXT("$objects"), Graph.Objects);
+	Data->SetObjectField(Key, JsonGraph);
+}
+
+/**
+* Reads a field into the value of any property, called by the GetAnyProperty thunk
+*
+* @param	Key				Key
+* @param	Property		The property describing the value
+* @param	PropertyData	Pointer to the value
+*
+* @return	Whether the field was found and read
+*/
+bool UJsonFieldData::GetAnyPropertyInternal(const FString& Key, const FProperty* Property, void* PropertyData)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	if (!Property || !PropertyData) {
+		return false;
+	}
+
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonJsonToProperty);
+	const TSharedPtr<FJsonValue> Value = FindField(Key);
+	if (!Value.IsValid()) {
+		return false;
+	}
+
+	// Written in graph mode: {"$value": ..., "$objects": [...]}, the objects are created next to the context
+	const TSharedPtr<FJsonObject>* JsonGraph;
+	const TArray<TSharedPtr<FJsonValue>>* Table;
+	if (Value->Type == EJson::Object && Value->TryGetObject(JsonGraph) && JsonGraph->IsValid()
+		&& (*JsonGraph)->HasField(TEXT("$value")) && (*JsonGraph)->TryGetArrayField(TEXT("$objects"), Table)) {
+		FJsonObjectGraphReader Graph(*Table, contextObject ? contextObject : GetTransientPackage());
+		TGuardValue<FJsonObjectGraphReader*> ActiveGraph(FJsonObjectGraphReader::Active, &Graph);
+		return SetJsonValueIntoProperty((*JsonGraph)->TryGetField(TEXT("$value")), Property, PropertyData);
+	}
+
+	return SetJsonValueIntoProperty(Value, Property, PropertyData);
+}
+
 TSharedPtr<FJsonObject> UJsonFieldData::CreateJsonValueFromUObjectProperty(const FObjectProperty* InObjectProperty,const void* InObjectData)
 {
 	check(InObjectProperty);
 
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
 	const UObject* Value = InObjectProperty->GetObjectPropertyValue(InObjectData);
 	if (!Value) return NULL;
 
+	// Graph mode, the object goes to the table once and is referenced by id
+	if (FJsonObjectGraphWriter* Graph = FJsonObjectGraphWriter::Active) {
+		return FJsonObjectGraphWriter::MakeReference(Graph->Add(Value, &CreateJsonValueFromUObject));
+	}
+
+	// Nested copies, a reference back to an object being written would never end
+	if (FJsonObjectVisit::Stack.Contains(Value)) {
+		UE_LOG(LogJson, Warning, TEXT("Cyclic reference to '%s' written as null, use Set Object Graph Mode to keep it"), *Value->GetName());
+		return NULL;
+	}
+	FJsonObjectVisit Visit(Value);
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
 	UClass* ObjectClass = Value->GetClass();
 	for (FProperty* Property = ObjectClass->PropertyLink; Property; Property = Property->PropertyLinkNext)
 	{
@@ -1399,6 +2871,7 @@ TSharedPtr<FJsonObject> UJsonFieldData::CreateJsonValueFromUObjectProperty(const
 TSharedPtr<FJsonObject> UJsonFieldData::CreateJsonValueFromUObject(const UObject * InObject)
 {
 	check(InObject);
+	FJsonObjectVisit Visit(InObject);
 	UClass* ObjectClass = InObject->GetClass();
 	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
 
@@ -1424,8 +2897,53 @@ TSharedPtr<FJsonObject> UJsonFieldData::CreateJsonValueFromUObject(const UObject
 	return JsonObject;
 }
 
+/**
+* Writes the graph of objects reachable from Root through SaveGame properties, each object once
+*
+* @param	Root		First object of the table
+*
+* @return	{"$objects": [...]}, where references between objects are {"$ref": id}
+*/
+TSharedPtr<FJsonObject> UJsonFieldData::CreateJsonGraphFromUObject(const UObject* Root)
+{
+	check(Root);
+	FJsonObjectGraphWriter Graph;
+	{
+		TGuardValue<FJsonObjectGraphWriter*> ActiveGraph(FJsonObjectGraphWriter::Active, &Graph);
+		Graph.Add(Root, &CreateJsonValueFromUObject);
+	}
+
+	TSharedPtr<FJsonObject> JsonGraph = MakeShared<FJsonObject>();
+	JsonGraph->SetArrayField(TEXT("$objects"), Graph.Objects);
+	return JsonGraph;
+}
+
+void UJsonFieldData::SetJsonObjectIntoUObject(const FJsonObject& JsonObject, UObject* Target)
+{
+	check(Target);
+	for (const auto& Field : JsonObject.Values) {
+		if (Field.Key.StartsWith(TEXT("$")) || !Field.Value.IsValid()) {
+			continue;
+		}
+
+		FProperty* FoundProperty = FindFProperty<FProperty>(Target->GetClass(), *Field.Key);
+		if (FoundProperty) {
+			SetJsonValueIntoProperty(Field.Value, FoundProperty, FoundProperty->ContainerPtrToValuePtr<uint8>(Target));
+		}
+		else {
+			UE_LOG(LogJson, Warning, TEXT("Missing Property %s in Object %s"), *Field.Key, *Target->GetName());
+		}
+	}
+}
+
 TSharedPtr<FJsonObject> UJsonFieldData::CreateJsonValueFromStruct(const FStructProperty* StructProperty, const void* StructPtr) {
 
+	// Structs with a registered codec skip the property walk
+	JsonCodec::FStructCodec Codec;
+	if (JsonCodec::FRegistry::Find(StructProperty->Struct, Codec)) {
+		return Codec.Write(StructPtr);
+	}
+
 	//check(InStruct);
 	TSharedPtr<FJsonObject> JsonStruct = MakeShareable(new FJsonObject());
 
@@ -1594,6 +3112,14 @@ TSharedPtr<FJsonValue>  UJsonFieldData::GetJsonValue(const FProperty * InPropert
 		auto Value = StrProperty->GetPropertyValue(InPropertyData);
 		return MakeShareable(new FJsonValueString(Value));
 	}
+	else if (const FNameProperty* NameProperty = CastField<FNameProperty>(InProperty))
+	{
+		return MakeShareable(new FJsonValueString(NameProperty->GetPropertyValue(InPropertyData).ToString()));
+	}
+	else if (const FTextProperty* TextProperty = CastField<FTextProperty>(InProperty))
+	{
+		return MakeShareable(new FJsonValueString(TextProperty->GetPropertyValue(InPropertyData).ToString()));
+	}
 	else if (const FNumericProperty *NumericProperty = CastField<const FNumericProperty>(InProperty))
 	{
 		//if (NumericProperty->IsEnum())
@@ -1628,10 +3154,16 @@ TSharedPtr<FJsonValue>  UJsonFieldData::GetJsonValue(const FProperty * InPropert
 		UObject* PropertyValue = ClassProp->GetPropertyValue(InPropertyData);
 		if (PropertyValue)
 		{
-			FString className = FStringClassReference(PropertyValue->GetClass()).ToString();
+			FString className = FStringClassReference(CastChecked<UClass>(PropertyValue)).ToString();
 			return MakeShareable(new FJsonValueString(className));
 		}
 	}
+	else if (const FSoftObjectProperty* SoftObjectProp = CastField<const FSoftObjectProperty>(InProperty))
+	{
+		// Soft object and soft class references are written as their path, nothing is loaded
+		const FSoftObjectPtr& SoftObject = SoftObjectProp->GetPropertyValue(InPropertyData);
+		return MakeShareable(new FJsonValueString(SoftObject.ToSoftObjectPath().ToString()));
+	}
 	else if (const FArrayProperty* ArrayProp = CastField<const FArrayProperty>(InProperty))
 	{
 		auto Array = CreateJsonValueFromArray(ArrayProp, InPropertyData);
@@ -1674,47 +3206,215 @@ TSharedPtr<FJsonValue>  UJsonFieldData::GetJsonValue(const FProperty * InPropert
 	return MakeShareable(new FJsonValueNull());
 }
 
+namespace
+{
+	/* Enum value from its name, user defined enums are written with their display name */
+	bool ParseEnumName(const UEnum* Enum, const FString& Name, int64& OutValue)
+	{
+		const int32 Index = Enum->GetIndexByNameString(Name);
+		if (Index != INDEX_NONE) {
+			OutValue = Enum->GetValueByIndex(Index);
+			return true;
+		}
+
+		for (int32 DisplayIndex = 0; DisplayIndex < Enum->NumEnums(); DisplayIndex++) {
+			if (Enum->GetDisplayNameTextByIndex(DisplayIndex).ToString() == Name) {
+				OutValue = Enum->GetValueByIndex(DisplayIndex);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/* Enum value from a number or a name */
+	bool ParseEnumValue(const UEnum* Enum, const FJsonValue& Value, int64& OutValue)
+	{
+		if (JsonNumber::TryGetInteger(Value, OutValue)) {
+			return true;
+		}
+
+		FString Name;
+		return Enum && Value.Type == EJson::String && Value.TryGetString(Name) && ParseEnumName(Enum, Name, OutValue);
+	}
+
+	/* Map key from the text exported by the writer, the common key types skip ImportText */
+	bool ParseMapKey(const FProperty* KeyProperty, const FString& Key, void* KeyData)
+	{
+		if (const FStrProperty* StrProperty = CastField<const FStrProperty>(KeyProperty)) {
+			StrProperty->SetPropertyValue(KeyData, Key);
+			return true;
+		}
+		if (const FNameProperty* NameProperty = CastField<const FNameProperty>(KeyProperty)) {
+			NameProperty->SetPropertyValue(KeyData, FName(*Key));
+			return true;
+		}
+		if (const FEnumProperty* EnumProperty = CastField<const FEnumProperty>(KeyProperty)) {
+			int64 Value;
+			if (!ParseEnumName(EnumProperty->GetEnum(), Key, Value) && !JsonNumber::ParseInteger(Key, Value)) {
+				return false;
+			}
+			EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(KeyData, Value);
+			return true;
+		}
+		if (const FNumericProperty* NumericProperty = CastField<const FNumericProperty>(KeyProperty)) {
+			const FByteProperty* ByteProperty = CastField<const FByteProperty>(KeyProperty);
+			int64 Value;
+			if (ByteProperty && ByteProperty->Enum && ParseEnumName(ByteProperty->Enum, Key, Value)) {
+				ByteProperty->SetIntPropertyValue(KeyData, Value);
+				return true;
+			}
+
+			JsonNumber::FParsedNumber Number;
+			const TCHAR* End = *Key + Key.Len();
+			if (JsonNumber::ParseNumber(*Key, End, Number) != End) {
+				return false;
+			}
+			if (NumericProperty->IsFloatingPoint()) {
+				NumericProperty->SetFloatingPointPropertyValue(KeyData, Number.Value);
+			}
+			else {
+				NumericProperty->SetIntPropertyValue(KeyData, Number.bIsInteger ? Number.Integer : (int64)Number.Value);
+			}
+			return true;
+		}
+		if (const FBoolProperty* BoolProperty = CastField<const FBoolProperty>(KeyProperty)) {
+			BoolProperty->SetPropertyValue(KeyData, Key.ToBool());
+			return true;
+		}
+
+		return KeyProperty->ImportText_Direct(*Key, KeyData, nullptr, PPF_None) != nullptr;
+	}
+
+	/* Property of a struct from the name it is written with, user defined structs suffix their property names with a GUID */
+	FProperty* FindStructProperty(const UStruct* Struct, const FString& Name)
+	{
+		if (FProperty* Property = Struct->FindPropertyByName(FName(*Name, FNAME_Find))) {
+			return Property;
+		}
+
+		for (TFieldIterator<FProperty> It(Struct); It; ++It) {
+			if (It->GetAuthoredName() == Name) {
+				return *It;
+			}
+		}
+		return nullptr;
+	}
+}
+
 bool UJsonFieldData::SetJsonValueIntoProperty(TSharedPtr<FJsonValue> Value, const FProperty * Property, void * PropertyData)
 {
 	check(Property);
 	check(PropertyData);
 
-	if (const FNumericProperty *NumericProperty = CastField<const FNumericProperty>(Property))
+	if (!Value.IsValid()) {
+		return false;
+	}
+
+	if (const FEnumProperty* EnumProperty = CastField<const FEnumProperty>(Property))
 	{
-		//if (NumericProperty->IsEnum())
-		if (const FByteProperty* ByteProperty = CastField<const FByteProperty>(Property))
+		int64 EnumValue;
+		if (!ParseEnumValue(EnumProperty->GetEnum(), *Value, EnumValue)) {
+			return false;
+		}
+		EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(PropertyData, EnumValue);
+	}
+	else if (const FNumericProperty *NumericProperty = CastField<const FNumericProperty>(Property))
+	{
+		if (const FByteProperty* ByteProperty = CastField<const FByteProperty>(Property); ByteProperty && ByteProperty->Enum)
 		{
-			if (UUserDefinedEnum* UDEnum = Cast<UUserDefinedEnum>(ByteProperty->Enum))
-			{
-				const FString EnumStringValue = Value->AsString();
-				int64 EnumIndexValue = UDEnum->GetIndexByNameString(EnumStringValue);
-				ByteProperty->SetIntPropertyValue(PropertyData, EnumIndexValue);
+			int64 EnumValue;
+			if (!ParseEnumValue(ByteProperty->Enum, *Value, EnumValue)) {
+				return false;
 			}
+			ByteProperty->SetIntPropertyValue(PropertyData, EnumValue);
 		}
 		else if (NumericProperty->IsFloatingPoint())
 		{
-			NumericProperty->SetFloatingPointPropertyValue(PropertyData, Value->AsNumber());
-			//UE_LOG(LogJson, Log, TEXT("Try unserial property %s with value %f"), *ValueKey, Value);
+			double Number;
+			if (!Value->TryGetNumber(Number)) {
+				return false;
+			}
+			NumericProperty->SetFloatingPointPropertyValue(PropertyData, Number);
 		}
 		else if (NumericProperty->IsInteger())
 		{
-			NumericProperty->SetIntPropertyValue(PropertyData, (int64)Value->AsNumber());
-			//UE_LOG(LogJson, Log, TEXT("Try unserial property %s value %d"), *ValueKey, Value);
+			// Exact past 2^53, int64 ids do not go through a double
+			int64 Integer;
+			double Number;
+			if (JsonNumber::TryGetInteger(*Value, Integer)) {
+				NumericProperty->SetIntPropertyValue(PropertyData, Integer);
+			}
+			else if (Value->TryGetNumber(Number)) {
+				NumericProperty->SetIntPropertyValue(PropertyData, (int64)Number);
+			}
+			else {
+				return false;
+			}
+		}
+	}
+	else if (const FBoolProperty* BoolProperty = CastField<const FBoolProperty>(Property))
+	{
+		bool bValue;
+		if (!Value->TryGetBool(bValue)) {
+			return false;
+		}
+		BoolProperty->SetPropertyValue(PropertyData, bValue);
+	}
+	else if (const FStrProperty* StrProperty = CastField<const FStrProperty>(Property))
+	{
+		FString String;
+		if (!Value->TryGetString(String)) {
+			return false;
+		}
+		StrProperty->SetPropertyValue(PropertyData, MoveTemp(String));
+	}
+	else if (const FNameProperty* NameProperty = CastField<const FNameProperty>(Property))
+	{
+		FString String;
+		if (!Value->TryGetString(String)) {
+			return false;
+		}
+		NameProperty->SetPropertyValue(PropertyData, FName(*String));
+	}
+	else if (const FTextProperty* TextProperty = CastField<const FTextProperty>(Property))
+	{
+		FString String;
+		if (!Value->TryGetString(String)) {
+			return false;
+		}
+		TextProperty->SetPropertyValue(PropertyData, FText::FromString(MoveTemp(String)));
+	}
+	else if (const FSoftObjectProperty* SoftObjectProp = CastField<const FSoftObjectProperty>(Property))
+	{
+		// Only the path is restored, the asset loads when it is used or with the async Get Asset nodes
+		FString Path;
+		if (!Value->TryGetString(Path)) {
+			return false;
 		}
+		SoftObjectProp->SetPropertyValue(PropertyData, FSoftObjectPtr(FSoftObjectPath(Path)));
 	}
 	else if (const FStructProperty* StructProp = CastField<const FStructProperty>(Property))
 	{
 		UStruct* Struct = StructProp->Struct;
 
-		TSharedPtr<FJsonObject> JsonStruct = Value->AsObject();
+		const TSharedPtr<FJsonObject>* JsonStructPtr;
+		if (!Value->TryGetObject(JsonStructPtr) || !JsonStructPtr->IsValid()) {
+			return false;
+		}
+		const TSharedPtr<FJsonObject>& JsonStruct = *JsonStructPtr;
+
+		JsonCodec::FStructCodec Codec;
+		if (JsonCodec::FRegistry::Find(StructProp->Struct, Codec)) {
+			Codec.Read(*JsonStruct, PropertyData);
+			return true;
+		}
 
 		for (auto currJsonValue = JsonStruct->Values.CreateConstIterator(); currJsonValue; ++currJsonValue) {
 			
 			TSharedPtr<FJsonValue> JStructValue = (*currJsonValue).Value;
 			const FString JValueKey = (*currJsonValue).Key;
 
-			//FProperty* FoundProperty = FindField<FProperty>(Struct->GetClass(), *ValueKey);
-			FProperty* FoundProperty = Struct->FindPropertyByName(*JValueKey);
+			FProperty* FoundProperty = FindStructProperty(Struct, JValueKey);
 
 			if (FoundProperty)
 			{
@@ -1723,41 +3423,219 @@ bool UJsonFieldData::SetJsonValueIntoProperty(TSharedPtr<FJsonValue> Value, cons
 			}
 			else 
 			{
-				UE_LOG(LogJson, Warning, TEXT("Missign Property %s in Struct %s."), *JValueKey, *(StructProp->GetFName().ToString()));
+				UE_LOG(LogJson, Warning, TEXT("Missing Property %s in Struct %s."), *JValueKey, *(StructProp->GetFName().ToString()));
 			}
 		}
 	}
+	else if (const FClassProperty* ClassProperty = CastField<const FClassProperty>(Property))
+	{
+		if (Value->IsNull()) {
+			ClassProperty->SetObjectPropertyValue(PropertyData, nullptr);
+			return true;
+		}
+
+		FString ClassPath;
+		if (!Value->TryGetString(ClassPath)) {
+			return false;
+		}
+		// Only classes already loaded are resolved, loading from document data would hitch while reading
+		UClass* Class = Cast<UClass>(JsonAssets::FindLoaded(ClassPath));
+		if (!Class || !Class->IsChildOf(ClassProperty->MetaClass)) {
+			return false;
+		}
+		ClassProperty->SetObjectPropertyValue(PropertyData, Class);
+	}
 	else if (const FObjectProperty* ObjectProperty = CastField<const FObjectProperty>(Property))
 	{
-		TSharedPtr<FJsonObject> JsonObject = Value->AsObject();
+		const TSharedPtr<FJsonObject>* JsonObjectPtr;
+		if (!Value->TryGetObject(JsonObjectPtr) || !JsonObjectPtr->IsValid()) {
+			return false;
+		}
+		TSharedPtr<FJsonObject> JsonObject = *JsonObjectPtr;
+
+		// Reference to an object of the graph being read
+		int32 ObjectId;
+		FJsonObjectGraphReader* Graph = FJsonObjectGraphReader::Active;
+		if (Graph && JsonObject->TryGetNumberField(TEXT("$ref"), ObjectId)) {
+			UObject* Resolved = Graph->Resolve(ObjectId, ObjectProperty->PropertyClass, ObjectProperty->GetObjectPropertyValue(PropertyData), &SetJsonObjectIntoUObject);
+			ObjectProperty->SetObjectPropertyValue(PropertyData, Resolved);
+			return Resolved != nullptr;
+		}
 
+		// Objects are not created outside of a graph, their fields go into the existing instance
 		UObject* TargetObject = ObjectProperty->GetObjectPropertyValue(PropertyData);
-
 		if (!TargetObject) 
 		{
 			return false;
 		}
+		SetJsonObjectIntoUObject(*JsonObject, TargetObject);
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<const FArrayProperty>(Property))
+	{
+		return SetJsonArrayIntoProperty(*Value, ArrayProperty, PropertyData);
+	}
+	else if (const FSetProperty* SetProperty = CastField<const FSetProperty>(Property))
+	{
+		return SetJsonSetIntoProperty(*Value, SetProperty, PropertyData);
+	}
+	else if (const FMapProperty* MapProperty = CastField<const FMapProperty>(Property))
+	{
+		return SetJsonMapIntoProperty(*Value, MapProperty, PropertyData);
+	}
+	else
+	{
+		return false;
+	}
 
-		for (auto currJsonValue = JsonObject->Values.CreateConstIterator(); currJsonValue; ++currJsonValue) {
+	return true;
+}
 
-			TSharedPtr<FJsonValue> JObjectValue = (*currJsonValue).Value;
-			const FString JValueKey = (*currJsonValue).Key;
+/**
+* Replace the content of an array property, the array is sized once for all the elements
+*
+* @return	False if the value is not an array or an element could not be read
+*/
+bool UJsonFieldData::SetJsonArrayIntoProperty(const FJsonValue& Value, const FArrayProperty* ArrayProperty, void* PropertyData)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Elements;
+	if (!Value.TryGetArray(Elements)) {
+		return false;
+	}
 
-			FProperty* FoundProperty = FindFProperty<FProperty>(TargetObject->GetClass(), *JValueKey);
-			//FProperty* FoundProperty = Struct->FindPropertyByName(*ValueKey);
+	FScriptArrayHelper ArrayHelper(ArrayProperty, PropertyData);
+	ArrayHelper.EmptyAndAddValues(Elements->Num());
 
-			if (FoundProperty)
-			{
-				void* FoundPropertyData = FoundProperty->ContainerPtrToValuePtr<uint8>(PropertyData);
-				SetJsonValueIntoProperty(JObjectValue, FoundProperty, FoundPropertyData);
-			}
-			else
-			{
-				UE_LOG(LogJson, Warning, TEXT("Missign Property %s in Object %s"), *JValueKey, *(ObjectProperty->GetFName().ToString()));
+	bool bSuccess = true;
+	for (int32 Index = 0; Index < Elements->Num(); Index++) {
+		bSuccess &= SetJsonValueIntoProperty((*Elements)[Index], ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index));
+	}
+	return bSuccess;
+}
+
+/**
+* Replace the content of a set property. Elements are read aside and added without hashing, the set is rehashed
+* once. Repeated elements of the array are dropped as they are read, through the hashes of the elements added so far.
+*
+* @return	False if the value is not an array or an element could not be read
+*/
+bool UJsonFieldData::SetJsonSetIntoProperty(const FJsonValue& Value, const FSetProperty* SetProperty, void* PropertyData)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Elements;
+	if (!Value.TryGetArray(Elements)) {
+		return false;
+	}
+
+	FScriptSetHelper SetHelper(SetProperty, PropertyData);
+	SetHelper.EmptyElements(Elements->Num());
+
+	const FProperty* ElementProperty = SetHelper.GetElementProperty();
+	void* Scratch = FMemory::Malloc(ElementProperty->GetSize(), ElementProperty->GetMinAlignment());
+
+	// Hash of each element added, to its index in the set
+	TMultiMap<uint32, int32> Added;
+	Added.Reserve(Elements->Num());
+	TArray<int32, TInlineAllocator<4>> SameHash;
+
+	bool bSuccess = true;
+	for (const TSharedPtr<FJsonValue>& Element : *Elements) {
+		if (!Element.IsValid()) {
+			bSuccess = false;
+			continue;
+		}
+
+		ElementProperty->InitializeValue(Scratch);
+		if (!SetJsonValueIntoProperty(Element, ElementProperty, Scratch)) {
+			bSuccess = false;
+		}
+		else {
+			const uint32 Hash = ElementProperty->GetValueTypeHash(Scratch);
+			SameHash.Reset();
+			Added.MultiFind(Hash, SameHash);
+			if (!SameHash.ContainsByPredicate([&](int32 Other) { return ElementProperty->Identical(SetHelper.GetElementPtr(Other), Scratch); })) {
+				const int32 Index = SetHelper.AddDefaultValue_Invalid_NeedsRehash();
+				ElementProperty->CopyCompleteValue(SetHelper.GetElementPtr(Index), Scratch);
+				Added.Add(Hash, Index);
 			}
 		}
+		ElementProperty->DestroyValue(Scratch);
 	}
+	SetHelper.Rehash();
 
-	return true;
+	FMemory::Free(Scratch);
+	return bSuccess;
+}
+
+/**
+* Replace the content of a map property from an object keyed by the exported key text.
+* The entries are added without hashing and the map is rehashed once. Texts parsing to a key already added, like "1"
+* and "01", replace the value of its entry. Entries whose key or value cannot be read are left out.
+*
+* @return	False if the value is not an object or an entry could not be read
+*/
+bool UJsonFieldData::SetJsonMapIntoProperty(const FJsonValue& Value, const FMapProperty* MapProperty, void* PropertyData)
+{
+	const TSharedPtr<FJsonObject>* JsonMap;
+	if (!Value.TryGetObject(JsonMap) || !JsonMap->IsValid()) {
+		return false;
+	}
+
+	FScriptMapHelper MapHelper(MapProperty, PropertyData);
+	MapHelper.EmptyValues((*JsonMap)->Values.Num());
+
+	// Keys are parsed aside so that a key which does not parse leaves no entry behind
+	const FProperty* KeyProperty = MapProperty->KeyProp;
+	const FProperty* ValueProperty = MapProperty->ValueProp;
+	void* Key = FMemory::Malloc(KeyProperty->GetSize(), KeyProperty->GetMinAlignment());
+	KeyProperty->InitializeValue(Key);
+
+	// Hash of each key added, to its entry
+	TMultiMap<uint32, int32> Added;
+	Added.Reserve((*JsonMap)->Values.Num());
+	TArray<int32, TInlineAllocator<4>> SameHash;
+
+	// Entries whose value could not be read, removed once the map is hashed
+	TArray<int32> Failed;
+
+	bool bSuccess = true;
+	for (const auto& Field : (*JsonMap)->Values) {
+		if (!ParseMapKey(KeyProperty, Field.Key, Key)) {
+			UE_LOG(LogJson, Warning, TEXT("Unable to read key %s of map %s."), *Field.Key, *MapProperty->GetName());
+			bSuccess = false;
+			continue;
+		}
+
+		const uint32 Hash = KeyProperty->GetValueTypeHash(Key);
+		SameHash.Reset();
+		Added.MultiFind(Hash, SameHash);
+		const int32* Existing = SameHash.FindByPredicate([&](int32 Other) { return KeyProperty->Identical(MapHelper.GetKeyPtr(Other), Key); });
+
+		int32 Index;
+		if (Existing) {
+			Index = *Existing;
+			ValueProperty->ClearValue(MapHelper.GetValuePtr(Index));
+		}
+		else {
+			Index = MapHelper.AddDefaultValue_Invalid_NeedsRehash();
+			KeyProperty->CopyCompleteValue(MapHelper.GetKeyPtr(Index), Key);
+			Added.Add(Hash, Index);
+		}
+
+		if (SetJsonValueIntoProperty(Field.Value, ValueProperty, MapHelper.GetValuePtr(Index))) {
+			Failed.Remove(Index);
+		}
+		else {
+			Failed.AddUnique(Index);
+			bSuccess = false;
+		}
+	}
+	MapHelper.Rehash();
+
+	for (const int32 Index : Failed) {
+		MapHelper.RemoveAt(Index);
+	}
+
+	KeyProperty->DestroyValue(Key);
+	FMemory::Free(Key);
+	return bSuccess;
 }
 
@@ -0,0 +1,323 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonFiles.h"
+#include "JsonBinary.h"
+#include "JsonFieldData.h"
+#include "JsonGlobals.h"
+#include "JsonParserStats.h"
+
+#include "Async/Async.h"
+#include "Async/AsyncFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace JsonFiles
+{
+	/* Items processed by a bounded number of worker tasks, a worker stops when the queue is empty */
+	class FWorkQueue : public TSharedFromThis<FWorkQueue, ESPMode::ThreadSafe>
+	{
+	public:
+		FWorkQueue(TFunction<void(int32)>&& InWork, int32 InMaxWorkers)
+			: Work(MoveTemp(InWork))
+			, MaxWorkers(InMaxWorkers)
+		{
+		}
+
+		void Push(int32 Item)
+		{
+			{
+				FScopeLock Lock(&Mutex);
+				Items.Add(Item);
+				if (Workers >= MaxWorkers) {
+					return;
+				}
+				Workers++;
+			}
+
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [This = AsShared()]()
+			{
+				This->Run();
+			});
+		}
+
+	private:
+		void Run()
+		{
+			for (;;) {
+				int32 Item;
+				{
+					FScopeLock Lock(&Mutex);
+					if (Head == Items.Num()) {
+						Workers--;
+						return;
+					}
+					Item = Items[Head++];
+				}
+				Work(Item);
+			}
+		}
+
+		TFunction<void(int32)> Work;
+		FCriticalSection Mutex;
+		TArray<int32> Items;
+		int32 Head = 0;
+		int32 Workers = 0;
+		const int32 MaxWorkers;
+	};
+
+	/* Requested names mapped to unique files */
+	struct FBatch
+	{
+		TArray<FString> Entries;
+		TArray<int32> EntryToFile;
+		TArray<FString> Files;
+		TArray<int32> FileUses;
+		TArray<FResult> Results;
+		TAtomic<int32> Remaining { 0 };
+		FOnCompleted OnCompleted;
+
+		FBatch(const TArray<FString>& Filenames, FOnCompleted&& InOnCompleted)
+			: Entries(Filenames)
+			, OnCompleted(MoveTemp(InOnCompleted))
+		{
+			TMap<FString, int32> Unique;
+			Unique.Reserve(Entries.Num());
+			EntryToFile.Reserve(Entries.Num());
+			for (const FString& Entry : Entries) {
+				FString Path = FPaths::ConvertRelativePathToFull(Entry);
+				FPaths::NormalizeFilename(Path);
+
+				const int32* Found = Unique.Find(Path);
+				const int32 File = Found ? *Found : Files.Add(Path);
+				if (!Found) {
+					Unique.Add(MoveTemp(Path), File);
+					FileUses.Add(0);
+				}
+				FileUses[File]++;
+				EntryToFile.Add(File);
+			}
+
+			Results.SetNum(Files.Num());
+			for (int32 File = 0; File < Files.Num(); File++) {
+				Results[File].Filename = Files[File];
+				Results[File].bShared = FileUses[File] > 1;
+			}
+			Remaining = Files.Num();
+		}
+
+		/* Marks a file as done, the last one sends the results to the game thread */
+		void Finish()
+		{
+			if (--Remaining > 0) {
+				return;
+			}
+
+			TArray<FResult> EntryResults;
+			EntryResults.Reserve(Entries.Num());
+			for (int32 Entry = 0; Entry < Entries.Num(); Entry++) {
+				FResult& Result = EntryResults.Add_GetRef(Results[EntryToFile[Entry]]);
+				Result.Filename = Entries[Entry];
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [Callback = MoveTemp(OnCompleted), EntryResults = MoveTemp(EntryResults)]() mutable
+			{
+				JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
+				Callback(MoveTemp(EntryResults));
+			});
+		}
+	};
+
+	class FLoadBatch : public FBatch, public TSharedFromThis<FLoadBatch, ESPMode::ThreadSafe>
+	{
+	public:
+		using FBatch::FBatch;
+
+		void Start()
+		{
+			if (Files.IsEmpty()) {
+				Remaining = 1;
+				Finish();
+				return;
+			}
+
+			Reads.SetNum(Files.Num());
+			Queue = MakeShared<FWorkQueue, ESPMode::ThreadSafe>([this](int32 File) { Process(File); }, GetMaxWorkers());
+			for (int32 Index = 0; Index < MaxPendingReads; Index++) {
+				IssueRead();
+			}
+		}
+
+	private:
+		struct FRead
+		{
+			IAsyncReadFileHandle* Handle = nullptr;
+			IAsyncReadRequest* Request = nullptr;
+			int64 Size = 0;
+
+			/* When the file was opened, for its IoTime */
+			double StartTime = 0.0;
+		};
+
+		/* Starts the next read, the files which cannot be opened are done right away */
+		void IssueRead()
+		{
+			for (;;) {
+				const int32 File = NextRead++;
+				if (File >= Files.Num()) {
+					return;
+				}
+
+				FRead& Read = Reads[File];
+				Read.StartTime = FPlatformTime::Seconds();
+				Read.Size = IFileManager::Get().FileSize(*Files[File]);
+
+				// Buffers and strings are indexed with int32
+				if (Read.Size > MAX_int32) {
+					UE_LOG(LogJson, Warning, TEXT("JSON: %s is larger than 2 GB and was not read"), *Files[File]);
+					Read.Size = -1;
+				}
+
+				Read.Handle = Read.Size >= 0 ? FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*Files[File]) : nullptr;
+				if (!Read.Handle) {
+					Results[File].IoTime = FPlatformTime::Seconds() - Read.StartTime;
+					Finish();
+					continue;
+				}
+
+				// The request is only used by the worker, once the read completed
+				FAsyncFileCallBack Callback = [This = AsShared(), File](bool bWasCancelled, IAsyncReadRequest* Request)
+				{
+					This->Reads[File].Request = Request;
+					This->Queue->Push(File);
+				};
+				Read.Handle->ReadRequest(0, Read.Size, AIOP_Normal, &Callback);
+				return;
+			}
+		}
+
+		void Process(int32 File)
+		{
+			// The requests hold the batch, the last one is deleted below
+			TSharedRef<FLoadBatch, ESPMode::ThreadSafe> KeepAlive = AsShared();
+			FRead& Read = Reads[File];
+			FResult& Result = Results[File];
+
+			Read.Request->WaitCompletion();
+			uint8* Data = Read.Request->GetReadResults();
+			delete Read.Request;
+			delete Read.Handle;
+			Read.Request = nullptr;
+			Read.Handle = nullptr;
+			Result.IoTime = FPlatformTime::Seconds() - Read.StartTime;
+
+			// A slot is free, keep MaxPendingReads files in flight
+			IssueRead();
+
+			if (Data) {
+				JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncFileRead);
+				LLM_SCOPE_BYTAG(JSONParser);
+				const double ParseStart = FPlatformTime::Seconds();
+
+				const TArrayView<const uint8> Buffer(Data, (int32)Read.Size);
+				if (FJsonBinary::IsBinary(Buffer)) {
+					Result.bSuccess = FJsonBinary::Read(Buffer, Result.Object);
+				}
+				else {
+					FString Text;
+					FFileHelper::BufferToString(Text, Data, (int32)Read.Size);
+					Result.bSuccess = UJsonFieldData::DeserializeObject(Text, Result.Object);
+				}
+				if (!Result.bSuccess) {
+					Result.Object.Reset();
+				}
+
+				Result.ProcessTime = FPlatformTime::Seconds() - ParseStart;
+				FMemory::Free(Data);
+			}
+
+			Finish();
+		}
+
+		TArray<FRead> Reads;
+		TAtomic<int32> NextRead { 0 };
+		TSharedPtr<FWorkQueue, ESPMode::ThreadSafe> Queue;
+	};
+
+	int32 GetMaxWorkers()
+	{
+		return FMath::Clamp(FPlatformMisc::NumberOfWorkerThreadsToSpawn() / 2, 1, 8);
+	}
+
+	TArray<FString> FindFiles(const FString& Directory, const FString& Wildcard)
+	{
+		TArray<FString> Names;
+		IFileManager::Get().FindFiles(Names, *FPaths::Combine(Directory, Wildcard), true, false);
+		for (FString& Name : Names) {
+			Name = FPaths::Combine(Directory, Name);
+		}
+		return Names;
+	}
+
+	void LoadAsync(const TArray<FString>& Filenames, FOnCompleted&& OnCompleted)
+	{
+		MakeShared<FLoadBatch, ESPMode::ThreadSafe>(Filenames, MoveTemp(OnCompleted))->Start();
+	}
+
+	void SaveAsync(const TArray<FString>& Filenames, const TArray<FSaveItem>& Items, FOnCompleted&& OnCompleted)
+	{
+		TSharedRef<FBatch, ESPMode::ThreadSafe> Batch = MakeShared<FBatch, ESPMode::ThreadSafe>(Filenames, MoveTemp(OnCompleted));
+		if (Batch->Files.IsEmpty()) {
+			Batch->Remaining = 1;
+			Batch->Finish();
+			return;
+		}
+
+		// Repeated paths are written once, with the last item requested for them
+		TArray<FSaveItem> FileItems;
+		FileItems.SetNum(Batch->Files.Num());
+		for (int32 Entry = 0; Entry < Batch->Entries.Num(); Entry++) {
+			if (Items.IsValidIndex(Entry)) {
+				FileItems[Batch->EntryToFile[Entry]] = Items[Entry];
+			}
+		}
+
+		TSharedRef<FWorkQueue, ESPMode::ThreadSafe> Queue = MakeShared<FWorkQueue, ESPMode::ThreadSafe>([Batch, FileItems = MoveTemp(FileItems)](int32 File)
+		{
+			FResult& Result = Batch->Results[File];
+			const FSaveItem& Item = FileItems[File];
+			if (Item.Object.IsValid()) {
+				LLM_SCOPE_BYTAG(JSONParser);
+				const double SerializeStart = FPlatformTime::Seconds();
+				bool bComplete = true;
+				const FString Text = UJsonFieldData::SerializeObject(ConstCastSharedPtr<FJsonObject>(Item.Object), Item.bPretty, Item.MaxDecimals, &bComplete);
+				Result.ProcessTime = FPlatformTime::Seconds() - SerializeStart;
+
+				JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncFileWrite);
+				const double WriteStart = FPlatformTime::Seconds();
+				Result.bSuccess = FFileHelper::SaveStringToFile(Text, *Batch->Files[File]) && bComplete;
+				Result.IoTime = FPlatformTime::Seconds() - WriteStart;
+			}
+			Batch->Finish();
+		}, GetMaxWorkers());
+
+		for (int32 File = 0; File < Batch->Files.Num(); File++) {
+			Queue->Push(File);
+		}
+	}
+}
@@ -0,0 +1,70 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Batches of JSON files read or written in parallel.
+ * Repeated paths are handled once. Reads go through IAsyncReadFileHandle with at most MaxPendingReads files in
+ * flight, parsing and serializing run on at most GetMaxWorkers() worker tasks, whatever the size of the batch.
+ * The completion runs once, on the game thread, with one result per requested file in the requested order.
+ */
+namespace JsonFiles
+{
+	struct FResult
+	{
+		FString Filename;
+		TSharedPtr<FJsonObject> Object;
+		bool bSuccess = false;
+
+		/* The same file was requested more than once, the entries share Object */
+		bool bShared = false;
+
+		/* Seconds spent reading or writing the file */
+		double IoTime = 0.0;
+
+		/* Seconds spent parsing or serializing the file */
+		double ProcessTime = 0.0;
+	};
+
+	/* An object to write and its layout */
+	struct FSaveItem
+	{
+		TSharedPtr<const FJsonObject> Object;
+		bool bPretty = true;
+
+		/* Number of decimals written for numbers, negative for the shortest exact form */
+		int32 MaxDecimals = -1;
+	};
+
+	using FOnCompleted = TFunction<void(TArray<FResult>&&)>;
+
+	constexpr int32 MaxPendingReads = 32;
+
+	int32 GetMaxWorkers();
+
+	/* Files of Directory matching Wildcard, with their directory */
+	TArray<FString> FindFiles(const FString& Directory, const FString& Wildcard);
+
+	/* Read and parse text or binary JSON files, any thread */
+	void LoadAsync(const TArray<FString>& Filenames, FOnCompleted&& OnCompleted);
+
+	/* Serialize and write one item per file, the last item wins for repeated paths, any thread */
+	void SaveAsync(const TArray<FString>& Filenames, const TArray<FSaveItem>& Items, FOnCompleted&& OnCompleted);
+}
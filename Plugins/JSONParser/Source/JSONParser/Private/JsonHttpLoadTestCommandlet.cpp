@@ -0,0 +1,202 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonHttpLoadTestCommandlet.h"
+
+#include "JsonLoader.h"
+#include "JsonLoopbackServer.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Parse.h"
+
+void UJsonHttpLoadProbe::OnCompleted(UJsonFieldData* Json, bool bInSuccess)
+{
+	bDone = true;
+	bSuccess = bInSuccess;
+}
+
+UJsonHttpLoadTestCommandlet::UJsonHttpLoadTestCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+#if WITH_JSON_TOOLS
+namespace JsonHttpLoadTest
+{
+	static double Percentile(TArray<double>& Values, float Ratio)
+	{
+		if (Values.Num() == 0) {
+			return 0.0;
+		}
+		Values.Sort();
+		const int32 Index = FMath::Clamp(FMath::FloorToInt(Ratio * (Values.Num() - 1)), 0, Values.Num() - 1);
+		return Values[Index];
+	}
+
+	static double Average(const TArray<double>& Values)
+	{
+		double Sum = 0.0;
+		for (double Value : Values) {
+			Sum += Value;
+		}
+		return Values.Num() ? Sum / Values.Num() : 0.0;
+	}
+}
+
+/**
+* Starts the loopback server, keeps Concurrency actions in flight until Requests responses are handled
+*
+* @param	Params		Command line
+*
+* @return	0 when every request succeeded
+*/
+int32 UJsonHttpLoadTestCommandlet::Main(const FString& Params)
+{
+	FJsonLoopbackServerSettings Settings;
+	int32 NumRequests = 1000;
+	int32 Concurrency = 32;
+	int32 PostSize = 1024;
+	float Timeout = 300.f;
+	FString Verb = TEXT("GET");
+
+	FParse::Value(*Params, TEXT("Requests="), NumRequests);
+	FParse::Value(*Params, TEXT("Concurrency="), Concurrency);
+	FParse::Value(*Params, TEXT("Size="), Settings.BodySize);
+	FParse::Value(*Params, TEXT("Latency="), Settings.LatencySeconds);
+	FParse::Value(*Params, TEXT("Port="), Settings.Port);
+	FParse::Value(*Params, TEXT("Verb="), Verb);
+	FParse::Value(*Params, TEXT("PostSize="), PostSize);
+	FParse::Value(*Params, TEXT("Timeout="), Timeout);
+	Settings.bGzip = FParse::Param(*Params, TEXT("Gzip"));
+
+	NumRequests = FMath::Max(NumRequests, 1);
+	Concurrency = FMath::Clamp(Concurrency, 1, NumRequests);
+	const bool bPost = !Verb.Equals(TEXT("GET"), ESearchCase::IgnoreCase);
+
+	FJsonLoopbackServer Server(Settings);
+	if (!Server.Start()) {
+		return 1;
+	}
+
+	// Payload sent by the POST actions
+	UJsonFieldData* Payload = NewObject<UJsonFieldData>();
+	Payload->AddToRoot();
+	Payload->FromString(FJsonLoopbackServer::MakeCannedBody(PostSize));
+
+	TArray<UJsonHttpLoadProbe*> InFlight;
+	TArray<double> RoundTrips, ParseTimes, GameThreadTimes;
+	int64 ResponseBytes = 0;
+	int32 Launched = 0, Finished = 0, Failed = 0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	double LastTick = StartTime;
+
+	while (Finished < NumRequests)
+	{
+		// Keep the pipe full
+		while (Launched < NumRequests && InFlight.Num() < Concurrency)
+		{
+			UJsonHttpLoadProbe* Probe = NewObject<UJsonHttpLoadProbe>();
+			Probe->AddToRoot();
+
+			if (bPost) {
+				auto* Action = UJSONAsyncAction_POSTHttpMessage::AsyncRequestHTTP(Probe, Server.GetURL(), Verb, Payload, TMap<FString, FString>(), TArray<FString>());
+				Action->Completed.AddDynamic(Probe, &UJsonHttpLoadProbe::OnCompleted);
+				Probe->Action = Action;
+				Action->Activate();
+			}
+			else {
+				auto* Action = UJSONAsyncAction_RequestHttpMessage::AsyncRequestHTTP(Probe, Server.GetURL(), TArray<FString>());
+				Action->Completed.AddDynamic(Probe, &UJsonHttpLoadProbe::OnCompleted);
+				Probe->Action = Action;
+				Action->Activate();
+			}
+
+			InFlight.Add(Probe);
+			++Launched;
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FTSTicker::GetCoreTicker().Tick(Now - LastTick);
+		LastTick = Now;
+
+		// Timings are complete once the completion lambda returned, collect them on the next loop
+		for (int32 i = InFlight.Num() - 1; i >= 0; --i)
+		{
+			UJsonHttpLoadProbe* Probe = InFlight[i];
+			if (!Probe->bDone) {
+				continue;
+			}
+
+			const FJsonHttpTimings& Timings = bPost
+				? CastChecked<UJSONAsyncAction_POSTHttpMessage>(Probe->Action)->Timings
+				: CastChecked<UJSONAsyncAction_RequestHttpMessage>(Probe->Action)->Timings;
+
+			if (Probe->bSuccess) {
+				RoundTrips.Add(Timings.RoundTrip);
+				ParseTimes.Add(Timings.Parse);
+				GameThreadTimes.Add(Timings.GameThread);
+				ResponseBytes += Timings.ResponseBytes;
+			}
+			else {
+				++Failed;
+			}
+
+			Probe->RemoveFromRoot();
+			InFlight.RemoveAtSwap(i);
+			++Finished;
+		}
+
+		if (Now - StartTime > Timeout) {
+			UE_LOG(LogJson, Error, TEXT("Load test timed out after %.0fs, %d/%d requests handled"), Timeout, Finished, NumRequests);
+			Failed += NumRequests - Finished;
+			break;
+		}
+
+		FPlatformProcess::Sleep(0.f);
+	}
+
+	const double WallTime = FPlatformTime::Seconds() - StartTime;
+
+	for (UJsonHttpLoadProbe* Probe : InFlight) {
+		Probe->RemoveFromRoot();
+	}
+	Payload->RemoveFromRoot();
+	Server.Stop();
+
+	using namespace JsonHttpLoadTest;
+	UE_LOG(LogJson, Display, TEXT("JSON HTTP load test: %d %s requests, concurrency %d, body %d bytes%s, latency %.3fs"),
+		NumRequests, *Verb.ToUpper(), Concurrency, Settings.BodySize, Settings.bGzip ? TEXT(" (gzip)") : TEXT(""), Settings.LatencySeconds);
+	UE_LOG(LogJson, Display, TEXT("  requests/s        : %.1f (%d failed, %.2fs wall)"), Finished / FMath::Max(WallTime, 1e-6), Failed, WallTime);
+	UE_LOG(LogJson, Display, TEXT("  received          : %.2f MB"), ResponseBytes / (1024.0 * 1024.0));
+	UE_LOG(LogJson, Display, TEXT("  round trip (ms)   : avg %.3f  p50 %.3f  p95 %.3f"), Average(RoundTrips) * 1000.0, Percentile(RoundTrips, 0.5f) * 1000.0, Percentile(RoundTrips, 0.95f) * 1000.0);
+	UE_LOG(LogJson, Display, TEXT("  parse (ms)        : avg %.3f  p95 %.3f"), Average(ParseTimes) * 1000.0, Percentile(ParseTimes, 0.95f) * 1000.0);
+	UE_LOG(LogJson, Display, TEXT("  game thread (ms)  : avg %.3f  p95 %.3f"), Average(GameThreadTimes) * 1000.0, Percentile(GameThreadTimes, 0.95f) * 1000.0);
+
+	return Failed == 0 ? 0 : 1;
+}
+#else
+int32 UJsonHttpLoadTestCommandlet::Main(const FString& Params)
+{
+	UE_LOG(LogJson, Error, TEXT("The JSON HTTP load test is not available in shipping builds"));
+	return 1;
+}
+#endif
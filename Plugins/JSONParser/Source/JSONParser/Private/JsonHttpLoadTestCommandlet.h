@@ -0,0 +1,61 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "JsonHttpLoadTestCommandlet.generated.h"
+
+class UJsonFieldData;
+
+/**
+* Receives the Completed event of one HTTP action for the load test
+*/
+UCLASS(Transient)
+class UJsonHttpLoadProbe : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION()
+	void OnCompleted(UJsonFieldData* Json, bool bSuccess);
+
+	/* The action this probe is bound to */
+	UPROPERTY()
+	UObject* Action = nullptr;
+
+	bool bDone = false;
+	bool bSuccess = false;
+};
+
+/**
+* Drives concurrent HTTP actions against the loopback server and reports their throughput.
+*
+* UnrealEditor-Cmd <Project> -run=JsonHttpLoadTest -nullrhi [-Requests=1000] [-Concurrency=32] [-Size=65536] [-Latency=0.0] [-Gzip] [-Verb=GET|POST] [-PostSize=1024] [-Port=18089]
+*/
+UCLASS()
+class UJsonHttpLoadTestCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UJsonHttpLoadTestCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
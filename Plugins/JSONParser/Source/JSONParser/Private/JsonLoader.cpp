@@ -16,11 +16,32 @@ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 */
 
 #include "JsonLoader.h"
+#include "JsonAssets.h"
+#include "JsonFiles.h"
+#include "JsonGlobals.h"
+#include "JsonParserStats.h"
+#include "JsonTexture.h"
 #include "Async/Async.h"
 #include "Misc/FileHelper.h"
 #include "Templates/Function.h"
+
+namespace JsonLoader
+{
+	/* Compiled once per action, the parse may run on a worker thread */
+	static TSharedPtr<const FJsonProjection> MakeProjection(const TArray<FString>& Fields)
+	{
+		if (Fields.Num() == 0) {
+			return nullptr;
+		}
+		return MakeShared<FJsonProjection>(Fields);
+	}
+}
+
 void UJSONAsyncAction_RequestHttpMessage::Activate()
 {
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncRequest);
+	LLM_SCOPE_BYTAG(JSONParser);
+
 	// Create HTTP Request
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 	HttpRequest->SetVerb("GET");
@@ -30,16 +51,25 @@ void UJSONAsyncAction_RequestHttpMessage::Activate()
 	// Setup Async response
 	HttpRequest->OnProcessRequestComplete().BindLambda([this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 	{
+		JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncResponse);
+		LLM_SCOPE_BYTAG(JSONParser);
+		const double StartTime = FPlatformTime::Seconds();
+		Timings.RoundTrip = StartTime - Timings.SentTime;
+
 		FString ResponseString = "";
 		if (bSuccess)
 		{
+			Timings.ResponseBytes = Response->GetContentLength();
 			ResponseString = Response->GetContentAsString();
 		}
 
 		this->HandleRequestCompleted(ResponseString, bSuccess);
+		Timings.GameThread = FPlatformTime::Seconds() - StartTime;
 	});
 
 	// Handle actual request
+	Timings = FJsonHttpTimings();
+	Timings.SentTime = FPlatformTime::Seconds();
 	HttpRequest->ProcessRequest();
 }
 
@@ -50,25 +80,31 @@ void UJSONAsyncAction_RequestHttpMessage::HandleRequestCompleted(const FString&
 	FString OutString;
 	if (bSuccess)
 	{
+		// The listeners allocate outside of the plugin tag, the scope ends before the broadcast
+		LLM_SCOPE_BYTAG(JSONParser);
+
 		/* Deserialize object */
+		const double ParseStart = FPlatformTime::Seconds();
 		TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
-		TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseString);
-		FJsonSerializer::Deserialize(JsonReader, JsonObject);
+		UJsonFieldData::DeserializeObject(ResponseString, JsonObject, Projection.Get());
+		Timings.Parse = FPlatformTime::Seconds() - ParseStart;
 
 		if (RegisteredWithGameInstance.IsValid()) {
 			JsonData = UJsonFieldData::CreateFromJson(RegisteredWithGameInstance.Get(), JsonObject);
 		}
 	}
 	
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
 	Completed.Broadcast(JsonData, bSuccess);
 }
 
 
-UJSONAsyncAction_RequestHttpMessage* UJSONAsyncAction_RequestHttpMessage::AsyncRequestHTTP(UObject* WorldContextObject, FString URL)
+UJSONAsyncAction_RequestHttpMessage* UJSONAsyncAction_RequestHttpMessage::AsyncRequestHTTP(UObject* WorldContextObject, FString URL, const TArray<FString>& Fields)
 {
 	// Create Action Instance for Blueprint System
 	UJSONAsyncAction_RequestHttpMessage* Action = NewObject<UJSONAsyncAction_RequestHttpMessage>();
 	Action->URL = URL;
+	Action->Projection = JsonLoader::MakeProjection(Fields);
 	Action->RegisterWithGameInstance(WorldContextObject);
 
 	return Action;
@@ -78,6 +114,9 @@ UJSONAsyncAction_RequestHttpMessage* UJSONAsyncAction_RequestHttpMessage::AsyncR
 
 void UJSONAsyncAction_POSTHttpMessage::Activate()
 {
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncRequest);
+	LLM_SCOPE_BYTAG(JSONParser);
+
 	// Create HTTP Request
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 	HttpRequest->SetVerb(this->Verb);
@@ -89,22 +128,40 @@ void UJSONAsyncAction_POSTHttpMessage::Activate()
 	//HttpRequest->AppendToHeader("Content-Type", "application/json");
 
 
-	HttpRequest->SetContentAsString(this->JSONContent);
+	if (!ContentFile.IsEmpty()) {
+		// Read from disk while sending, the body is never held in memory
+		HttpRequest->SetContentAsStreamedFile(ContentFile);
+	}
+	else if (Content.Num()) {
+		HttpRequest->SetContent(MoveTemp(Content));
+	}
+	else {
+		HttpRequest->SetContentAsString(this->JSONContent);
+	}
 	HttpRequest->SetURL(URL);
 
 	// Setup Async response
 	HttpRequest->OnProcessRequestComplete().BindLambda([this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 	{
+		JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncResponse);
+		LLM_SCOPE_BYTAG(JSONParser);
+		const double StartTime = FPlatformTime::Seconds();
+		Timings.RoundTrip = StartTime - Timings.SentTime;
+
 		FString ResponseString = "";
 		if (bSuccess)
 		{
+			Timings.ResponseBytes = Response->GetContentLength();
 			ResponseString = Response->GetContentAsString();
 		}
 
 		this->HandleRequestCompleted(ResponseString, bSuccess);
+		Timings.GameThread = FPlatformTime::Seconds() - StartTime;
 	});
 
 	// Handle actual request
+	Timings = FJsonHttpTimings();
+	Timings.SentTime = FPlatformTime::Seconds();
 	HttpRequest->ProcessRequest();
 }
 
@@ -115,21 +172,26 @@ void UJSONAsyncAction_POSTHttpMessage::HandleRequestCompleted(const FString& Res
 	FString OutString;
 	if (bSuccess)
 	{
+		// The listeners allocate outside of the plugin tag, the scope ends before the broadcast
+		LLM_SCOPE_BYTAG(JSONParser);
+
 		/* Deserialize object */
+		const double ParseStart = FPlatformTime::Seconds();
 		TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
-		TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseString);
-		FJsonSerializer::Deserialize(JsonReader, JsonObject);
+		UJsonFieldData::DeserializeObject(ResponseString, JsonObject, Projection.Get());
+		Timings.Parse = FPlatformTime::Seconds() - ParseStart;
 
 		if (RegisteredWithGameInstance.IsValid()) {
 			JsonData = UJsonFieldData::CreateFromJson(RegisteredWithGameInstance.Get(), JsonObject);
 		}
 	}
 
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
 	Completed.Broadcast(JsonData, bSuccess);
 }
 
 
-UJSONAsyncAction_POSTHttpMessage* UJSONAsyncAction_POSTHttpMessage::AsyncRequestHTTP(UObject* WorldContextObject, FString URL, FString Verb, UJsonFieldData* Json, const TMap<FString, FString>& Header)
+UJSONAsyncAction_POSTHttpMessage* UJSONAsyncAction_POSTHttpMessage::AsyncRequestHTTP(UObject* WorldContextObject, FString URL, FString Verb, UJsonFieldData* Json, const TMap<FString, FString>& Header, const TArray<FString>& Fields)
 {
 	if (!Json) return NULL;
 	// Create Action Instance for Blueprint System
@@ -138,6 +200,32 @@ UJSONAsyncAction_POSTHttpMessage* UJSONAsyncAction_POSTHttpMessage::AsyncRequest
 	Action->Verb = Verb;
 	Action->JSONContent = Json->GetContentString();
 	Action->Header = Header;
+	Action->Projection = JsonLoader::MakeProjection(Fields);
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
+
+UJSONAsyncAction_POSTHttpMessage* UJSONAsyncAction_POSTHttpMessage::AsyncSendStream(UObject* WorldContextObject, FString URL, FString Verb, UJsonStreamWriter* Writer, const TMap<FString, FString>& Header, const TArray<FString>& Fields)
+{
+	if (!Writer) return NULL;
+	if (!Writer->Close()) {
+		UE_LOG(LogJson, Warning, TEXT("The JSON stream is incomplete, it is not sent to %s"), *URL);
+		return NULL;
+	}
+
+	// Create Action Instance for Blueprint System
+	UJSONAsyncAction_POSTHttpMessage* Action = NewObject<UJSONAsyncAction_POSTHttpMessage>();
+	Action->URL = URL;
+	Action->Verb = Verb;
+	if (Writer->GetFilename().IsEmpty()) {
+		Action->Content = Writer->TakeBytes();
+	}
+	else {
+		Action->ContentFile = Writer->GetFilename();
+	}
+	Action->Header = Header;
+	Action->Projection = JsonLoader::MakeProjection(Fields);
 	Action->RegisterWithGameInstance(WorldContextObject);
 
 	return Action;
@@ -151,7 +239,12 @@ void UJSONAsyncAction_RequestFile::Activate()
 	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]()
 	{
 		FString FileData;
-		auto Result = FFileHelper::LoadFileToString(FileData, *Filename);
+		bool Result;
+		{
+			JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncFileRead);
+			LLM_SCOPE_BYTAG(JSONParser);
+			Result = FFileHelper::LoadFileToString(FileData, *Filename);
+		}
 		HandleRequestCompleted(FileData, Result);
 	});
 }
@@ -164,10 +257,11 @@ void UJSONAsyncAction_RequestFile::HandleRequestCompleted(const FString& Respons
 	FString OutString;
 	if (bSuccess)
 	{
+		LLM_SCOPE_BYTAG(JSONParser);
+
 		/* Deserialize object */
 		TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
-		TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseString);
-		FJsonSerializer::Deserialize(JsonReader, JsonObject);
+		UJsonFieldData::DeserializeObject(ResponseString, JsonObject, Projection.Get());
 
 		if (RegisteredWithGameInstance.IsValid()) {
 			JsonData = UJsonFieldData::CreateFromJson(RegisteredWithGameInstance.Get(), JsonObject);
@@ -176,17 +270,19 @@ void UJSONAsyncAction_RequestFile::HandleRequestCompleted(const FString& Respons
 
 	AsyncTask(ENamedThreads::GameThread, [this, JsonData, bSuccess]()
 	{
+		JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
 		Completed.Broadcast(JsonData, bSuccess);
 		//SetReadyToDestroy();
 	});
 }
 
 
-UJSONAsyncAction_RequestFile* UJSONAsyncAction_RequestFile::AsyncRequestFile(UObject* WorldContextObject, FString Filename)
+UJSONAsyncAction_RequestFile* UJSONAsyncAction_RequestFile::AsyncRequestFile(UObject* WorldContextObject, FString Filename, const TArray<FString>& Fields)
 {
 	// Create Action Instance for Blueprint System
 	auto Action = NewObject<UJSONAsyncAction_RequestFile>();
 	Action->Filename = Filename;
+	Action->Projection = JsonLoader::MakeProjection(Fields);
 	Action->RegisterWithGameInstance(WorldContextObject);
 
 	return Action;
@@ -199,6 +295,8 @@ void UJSONAsyncAction_SaveFile::Activate()
 {
 	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]()
 	{
+		JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncFileWrite);
+		LLM_SCOPE_BYTAG(JSONParser);
 		auto Result = FFileHelper::SaveStringToFile(JSONContent, *Filename);
 		HandleRequestCompleted(Result);
 	});
@@ -213,6 +311,7 @@ void UJSONAsyncAction_SaveFile::HandleRequestCompleted(bool bSuccess)
 
 	AsyncTask(ENamedThreads::GameThread, [this, bSuccess]()
 	{
+		JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
 		Completed.Broadcast(bSuccess);
 		//SetReadyToDestroy();
 	});
@@ -228,4 +327,375 @@ UJSONAsyncAction_SaveFile* UJSONAsyncAction_SaveFile::AsyncRequestFile(UObject*
 	Action->RegisterWithGameInstance(WorldContextObject);
 
 	return Action;
-}
\ No newline at end of file
+}
+/// <summary>
+/// ////////////////
+/// </summary>
+void UJSONAsyncAction_RequestFiles::Activate()
+{
+	TWeakObjectPtr<UJSONAsyncAction_RequestFiles> WeakThis(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, Filenames = Filenames, Directory = Directory, Wildcard = Wildcard]() mutable
+	{
+		if (!Directory.IsEmpty()) {
+			Filenames.Append(JsonFiles::FindFiles(Directory, Wildcard));
+		}
+
+		JsonFiles::LoadAsync(Filenames, [WeakThis](TArray<JsonFiles::FResult>&& Results)
+		{
+			if (WeakThis.IsValid()) {
+				WeakThis->HandleRequestCompleted(MoveTemp(Results));
+			}
+		});
+	});
+}
+
+void UJSONAsyncAction_RequestFiles::HandleRequestCompleted(TArray<JsonFiles::FResult>&& Results)
+{
+	UObject* Context = RegisteredWithGameInstance.Get();
+
+	TArray<FJsonFileResult> FileResults;
+	bool bSuccess = true;
+	{
+		// The listeners allocate outside of the plugin tag, the scope ends before the broadcast
+		LLM_SCOPE_BYTAG(JSONParser);
+		FileResults.Reserve(Results.Num());
+		for (JsonFiles::FResult& Result : Results) {
+			FJsonFileResult& FileResult = FileResults.AddDefaulted_GetRef();
+			FileResult.Filename = MoveTemp(Result.Filename);
+			FileResult.bSuccess = Result.bSuccess;
+			FileResult.IoTime = Result.IoTime;
+			FileResult.ProcessTime = Result.ProcessTime;
+
+			// Entries of a file requested twice share its document, writes to one entry do not reach the others
+			if (Result.bSuccess && Context) {
+				FileResult.Json = UJsonFieldData::CreateFromJson(Context, Result.Object, Result.bShared);
+			}
+			bSuccess &= Result.bSuccess;
+		}
+	}
+
+	Completed.Broadcast(FileResults, bSuccess);
+	SetReadyToDestroy();
+}
+
+UJSONAsyncAction_RequestFiles* UJSONAsyncAction_RequestFiles::AsyncRequestFiles(UObject* WorldContextObject, const TArray<FString>& Filenames)
+{
+	auto* Action = NewObject<UJSONAsyncAction_RequestFiles>();
+	Action->Filenames = Filenames;
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
+
+UJSONAsyncAction_RequestFiles* UJSONAsyncAction_RequestFiles::AsyncRequestDirectory(UObject* WorldContextObject, FString Directory, FString Wildcard)
+{
+	auto* Action = NewObject<UJSONAsyncAction_RequestFiles>();
+	Action->Directory = Directory;
+	Action->Wildcard = Wildcard.IsEmpty() ? TEXT("*") : Wildcard;
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
+
+/// <summary>
+/// ////////////////
+/// </summary>
+void UJSONAsyncAction_SaveFiles::Activate()
+{
+	TWeakObjectPtr<UJSONAsyncAction_SaveFiles> WeakThis(this);
+	TArray<JsonFiles::FSaveItem> Items;
+	Items.SetNum(Objects.Num());
+	for (int32 Index = 0; Index < Objects.Num(); Index++) {
+		Items[Index].Object = MoveTemp(Objects[Index]);
+		Items[Index].bPretty = bWritePretty;
+		Items[Index].MaxDecimals = Decimals[Index];
+	}
+
+	JsonFiles::SaveAsync(Filenames, Items, [WeakThis](TArray<JsonFiles::FResult>&& Results)
+	{
+		if (WeakThis.IsValid()) {
+			WeakThis->HandleRequestCompleted(MoveTemp(Results));
+		}
+	});
+}
+
+void UJSONAsyncAction_SaveFiles::HandleRequestCompleted(TArray<JsonFiles::FResult>&& Results)
+{
+	TArray<FJsonFileResult> FileResults;
+	FileResults.Reserve(Results.Num());
+	bool bSuccess = true;
+	for (JsonFiles::FResult& Result : Results) {
+		FJsonFileResult& FileResult = FileResults.AddDefaulted_GetRef();
+		FileResult.Filename = MoveTemp(Result.Filename);
+		FileResult.bSuccess = Result.bSuccess;
+		FileResult.IoTime = Result.IoTime;
+		FileResult.ProcessTime = Result.ProcessTime;
+		bSuccess &= Result.bSuccess;
+	}
+
+	Completed.Broadcast(FileResults, bSuccess);
+	SetReadyToDestroy();
+}
+
+UJSONAsyncAction_SaveFiles* UJSONAsyncAction_SaveFiles::AsyncSaveFiles(UObject* WorldContextObject, const TArray<UJsonFieldData*>& Jsons, const TArray<FString>& Filenames, bool bPretty)
+{
+	auto* Action = NewObject<UJSONAsyncAction_SaveFiles>();
+	Action->Filenames = Filenames;
+	Action->bWritePretty = bPretty;
+	Action->Objects.SetNum(Filenames.Num());
+	Action->Decimals.Init(-1, Filenames.Num());
+	for (int32 Index = 0; Index < Filenames.Num(); Index++) {
+		UJsonFieldData* Json = Jsons.IsValidIndex(Index) ? Jsons[Index] : nullptr;
+		if (!IsValid(Json)) {
+			continue;
+		}
+
+		// Copy-on-write documents are captured in O(1), the others are copied so that their mode is left as is
+		Action->Objects[Index] = Json->IsCopyOnWrite() ? Json->Snapshot().GetRoot() : UJsonFieldData::DeepClone(Json->ReadObject());
+		Action->Decimals[Index] = Json->MaxDecimals;
+	}
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
+
+/// <summary>
+/// ////////////////
+/// </summary>
+void UJSONAsyncAction_GetTexture::Activate()
+{
+	TWeakObjectPtr<UJSONAsyncAction_GetTexture> WeakThis(this);
+	JsonTexture::DecodeAsync(Source, [WeakThis](UTexture2D* Texture)
+	{
+		if (WeakThis.IsValid()) {
+			WeakThis->HandleRequestCompleted(Texture);
+		}
+	});
+}
+
+void UJSONAsyncAction_GetTexture::HandleRequestCompleted(UTexture2D* Texture)
+{
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
+	Completed.Broadcast(Texture, Texture != nullptr);
+	SetReadyToDestroy();
+}
+
+UJSONAsyncAction_GetTexture* UJSONAsyncAction_GetTexture::AsyncGetTexture(UObject* WorldContextObject, UJsonFieldData* Json, FString Key)
+{
+	// The field is read now, later writes to the JSON do not change the texture
+	auto* Action = NewObject<UJSONAsyncAction_GetTexture>();
+	if (IsValid(Json) && Json->HasKey(Key)) {
+		Action->Source = Json->GetString(Key);
+	}
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
+
+/// <summary>
+/// ////////////////
+/// </summary>
+void UJSONAsyncAction_GetTextureArray::Activate()
+{
+	Textures.SetNumZeroed(Sources.Num());
+	Remaining = Sources.Num();
+	if (Remaining == 0) {
+		HandleRequestCompleted(INDEX_NONE, nullptr);
+		return;
+	}
+
+	// Decodes run side by side, identical images in the array decode once
+	TWeakObjectPtr<UJSONAsyncAction_GetTextureArray> WeakThis(this);
+	for (int32 i = 0; i < Sources.Num(); i++) {
+		JsonTexture::DecodeAsync(Sources[i], [WeakThis, i](UTexture2D* Texture)
+		{
+			if (WeakThis.IsValid()) {
+				WeakThis->HandleRequestCompleted(i, Texture);
+			}
+		});
+	}
+}
+
+void UJSONAsyncAction_GetTextureArray::HandleRequestCompleted(int32 Index, UTexture2D* Texture)
+{
+	if (Textures.IsValidIndex(Index)) {
+		Textures[Index] = Texture;
+		bSuccess &= Texture != nullptr;
+		Remaining--;
+	}
+
+	if (Remaining == 0) {
+		JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
+		Completed.Broadcast(Textures, bSuccess);
+		SetReadyToDestroy();
+	}
+}
+
+UJSONAsyncAction_GetTextureArray* UJSONAsyncAction_GetTextureArray::AsyncGetTextureArray(UObject* WorldContextObject, UJsonFieldData* Json, FString Key)
+{
+	auto* Action = NewObject<UJSONAsyncAction_GetTextureArray>();
+	if (IsValid(Json)) {
+		Action->Sources = Json->GetStringArray(Key);
+	}
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
+
+/// <summary>
+/// ////////////////
+/// </summary>
+void UJSONAsyncAction_SetTexture::Activate()
+{
+	if (!IsValid(Json) || !IsValid(Texture)) {
+		HandleRequestCompleted(false, FString());
+		return;
+	}
+
+	TWeakObjectPtr<UJSONAsyncAction_SetTexture> WeakThis(this);
+	JsonTexture::EncodeAsync(Texture, [WeakThis](bool bSuccess, const FString& DataUrl)
+	{
+		if (WeakThis.IsValid()) {
+			WeakThis->HandleRequestCompleted(bSuccess, DataUrl);
+		}
+	});
+}
+
+void UJSONAsyncAction_SetTexture::HandleRequestCompleted(bool bSuccess, const FString& DataUrl)
+{
+	if (bSuccess && IsValid(Json) && !Json->IsFrozen()) {
+		Json->SetString(Key, DataUrl);
+	}
+	else {
+		bSuccess = false;
+	}
+
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
+	Completed.Broadcast(bSuccess);
+	SetReadyToDestroy();
+}
+
+UJSONAsyncAction_SetTexture* UJSONAsyncAction_SetTexture::AsyncSetTexture(UObject* WorldContextObject, UJsonFieldData* Json, FString Key, UTexture2D* Texture)
+{
+	auto* Action = NewObject<UJSONAsyncAction_SetTexture>();
+	Action->Json = Json;
+	Action->Key = Key;
+	Action->Texture = Texture;
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
+
+/// <summary>
+/// ////////////////
+/// </summary>
+void UJSONAsyncAction_GetClass::Activate()
+{
+	TWeakObjectPtr<UJSONAsyncAction_GetClass> WeakThis(this);
+	JsonAssets::LoadAsync({ Path }, [WeakThis](const TArray<UObject*>& Objects)
+	{
+		if (WeakThis.IsValid()) {
+			WeakThis->HandleRequestCompleted(Objects);
+		}
+	});
+}
+
+void UJSONAsyncAction_GetClass::HandleRequestCompleted(const TArray<UObject*>& Objects)
+{
+	UClass* Class = Objects.Num() ? Cast<UClass>(Objects[0]) : nullptr;
+
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
+	Completed.Broadcast(Class, Class != nullptr);
+	SetReadyToDestroy();
+}
+
+UJSONAsyncAction_GetClass* UJSONAsyncAction_GetClass::AsyncGetClass(UObject* WorldContextObject, UJsonFieldData* Json, FString Key)
+{
+	auto* Action = NewObject<UJSONAsyncAction_GetClass>();
+	if (IsValid(Json) && Json->HasKey(Key)) {
+		Action->Path = Json->GetString(Key);
+	}
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
+
+/// <summary>
+/// ////////////////
+/// </summary>
+void UJSONAsyncAction_GetClassArray::Activate()
+{
+	TWeakObjectPtr<UJSONAsyncAction_GetClassArray> WeakThis(this);
+	JsonAssets::LoadAsync(Paths, [WeakThis](const TArray<UObject*>& Objects)
+	{
+		if (WeakThis.IsValid()) {
+			WeakThis->HandleRequestCompleted(Objects);
+		}
+	});
+}
+
+void UJSONAsyncAction_GetClassArray::HandleRequestCompleted(const TArray<UObject*>& Objects)
+{
+	TArray<UClass*> Classes;
+	Classes.Reserve(Objects.Num());
+	bool bSuccess = true;
+	for (UObject* Object : Objects) {
+		UClass* Class = Cast<UClass>(Object);
+		bSuccess &= Class != nullptr;
+		Classes.Add(Class);
+	}
+
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
+	Completed.Broadcast(Classes, bSuccess);
+	SetReadyToDestroy();
+}
+
+UJSONAsyncAction_GetClassArray* UJSONAsyncAction_GetClassArray::AsyncGetClassArray(UObject* WorldContextObject, UJsonFieldData* Json, FString Key)
+{
+	auto* Action = NewObject<UJSONAsyncAction_GetClassArray>();
+	if (IsValid(Json)) {
+		Action->Paths = Json->GetStringArray(Key);
+	}
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
+
+/// <summary>
+/// ////////////////
+/// </summary>
+void UJSONAsyncAction_GetSoftObjects::Activate()
+{
+	TWeakObjectPtr<UJSONAsyncAction_GetSoftObjects> WeakThis(this);
+	JsonAssets::LoadAsync(Paths, [WeakThis](const TArray<UObject*>& Objects)
+	{
+		if (WeakThis.IsValid()) {
+			WeakThis->HandleRequestCompleted(Objects);
+		}
+	});
+}
+
+void UJSONAsyncAction_GetSoftObjects::HandleRequestCompleted(const TArray<UObject*>& Objects)
+{
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
+	Completed.Broadcast(Objects, Paths.Num() > 0 && !Objects.Contains(nullptr));
+	SetReadyToDestroy();
+}
+
+UJSONAsyncAction_GetSoftObjects* UJSONAsyncAction_GetSoftObjects::AsyncGetSoftObjects(UObject* WorldContextObject, UJsonFieldData* Json, FString Key)
+{
+	auto* Action = NewObject<UJSONAsyncAction_GetSoftObjects>();
+	if (IsValid(Json)) {
+		const TSharedPtr<FJsonValue> Field = Json->FindField(Key);
+		FString Path;
+		if (Field.IsValid() && Field->TryGetString(Path)) {
+			Action->Paths.Add(Path);
+		}
+		else {
+			Action->Paths = Json->GetStringArray(Key);
+		}
+	}
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
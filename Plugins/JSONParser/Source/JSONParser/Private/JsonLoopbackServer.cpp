@@ -0,0 +1,200 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonLoopbackServer.h"
+
+#if WITH_JSON_TOOLS
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "Containers/Ticker.h"
+#include "Misc/Compression.h"
+#include "Misc/ConfigCacheIni.h"
+#include "JsonGlobals.h"
+
+FJsonLoopbackServer::FJsonLoopbackServer(const FJsonLoopbackServerSettings& InSettings)
+	: Settings(InSettings)
+	, RequestCount(0)
+{
+}
+
+FJsonLoopbackServer::~FJsonLoopbackServer()
+{
+	Stop();
+}
+
+/**
+* Binds the JSON route on the loopback port and starts listening
+*
+* @return	True if the router could be created
+*/
+bool FJsonLoopbackServer::Start()
+{
+	if (bStarted) {
+		return true;
+	}
+
+	// The listener of the port reads its bind address from the config when it is created, whatever the project sets
+	TArray<FString> Overrides;
+	GConfig->GetArray(TEXT("HTTPServer.Listeners"), TEXT("ListenerOverrides"), Overrides, GEngineIni);
+	Overrides.AddUnique(FString::Printf(TEXT("(Port=%u,BindAddress=\"127.0.0.1\")"), Settings.Port));
+	GConfig->SetArray(TEXT("HTTPServer.Listeners"), TEXT("ListenerOverrides"), Overrides, GEngineIni);
+
+	FHttpServerModule& HttpServer = FHttpServerModule::Get();
+	Router = HttpServer.GetHttpRouter(Settings.Port, /* bFailOnBindFailure */ true);
+	if (!Router.IsValid()) {
+		UE_LOG(LogJson, Error, TEXT("Loopback server: unable to bind port %u"), Settings.Port);
+		return false;
+	}
+
+	RouteHandle = Router->BindRoute(FHttpPath(TEXT("/json")), EHttpServerRequestVerbs::VERB_GET | EHttpServerRequestVerbs::VERB_POST | EHttpServerRequestVerbs::VERB_PUT,
+		FHttpRequestHandler::CreateLambda([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		int32 Size = Settings.BodySize;
+		float Latency = Settings.LatencySeconds;
+		bool bGzip = Settings.bGzip;
+
+		if (const FString* Value = Request.QueryParams.Find(TEXT("size"))) {
+			Size = FCString::Atoi(**Value);
+		}
+		if (const FString* Value = Request.QueryParams.Find(TEXT("latency"))) {
+			Latency = FCString::Atof(**Value);
+		}
+		if (const FString* Value = Request.QueryParams.Find(TEXT("gzip"))) {
+			bGzip = Value->ToBool();
+		}
+
+		TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+		Response->Code = EHttpServerResponseCodes::Ok;
+		Response->Body = GetBody(Size, bGzip);
+		Response->Headers.Add(TEXT("content-type"), { TEXT("application/json") });
+		if (bGzip) {
+			Response->Headers.Add(TEXT("content-encoding"), { TEXT("gzip") });
+		}
+		++RequestCount;
+
+		if (Latency <= 0.f) {
+			OnComplete(MoveTemp(Response));
+			return true;
+		}
+
+		// Hold the response back on the core ticker to simulate the network latency
+		TSharedRef<TUniquePtr<FHttpServerResponse>> Pending = MakeShared<TUniquePtr<FHttpServerResponse>>(MoveTemp(Response));
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([OnComplete, Pending](float)
+		{
+			OnComplete(MoveTemp(*Pending));
+			return false;
+		}), Latency);
+
+		return true;
+	}));
+
+	HttpServer.StartAllListeners();
+	bStarted = true;
+
+	UE_LOG(LogJson, Log, TEXT("Loopback server listening on %s"), *GetURL());
+	return true;
+}
+
+/**
+* Unbinds the route. The listener of the port stays open for the other routes bound to it, the module closes it
+* on shutdown
+*/
+void FJsonLoopbackServer::Stop()
+{
+	if (!bStarted) {
+		return;
+	}
+
+	if (Router.IsValid() && RouteHandle.IsValid()) {
+		Router->UnbindRoute(RouteHandle);
+	}
+
+	Router.Reset();
+	RouteHandle.Reset();
+	bStarted = false;
+}
+
+FString FJsonLoopbackServer::GetURL() const
+{
+	return FString::Printf(TEXT("http://127.0.0.1:%u/json"), Settings.Port);
+}
+
+/**
+* Builds a document made of records until it reaches the requested size
+*
+* @param	ApproxSize	Size in bytes, the result is slightly bigger
+*
+* @return	A valid JSON document
+*/
+FString FJsonLoopbackServer::MakeCannedBody(int32 ApproxSize)
+{
+	FString Body;
+	Body.Reserve(ApproxSize + 256);
+	Body += TEXT("{\"count\":0,\"items\":[");
+
+	int32 Index = 0;
+	while (Body.Len() < ApproxSize || Index == 0) {
+		if (Index > 0) {
+			Body += TEXT(",");
+		}
+		Body += FString::Printf(
+			TEXT("{\"id\":%d,\"name\":\"item_%d\",\"price\":%.2f,\"enabled\":%s,\"position\":{\"X\":%.3f,\"Y\":%.3f,\"Z\":%.3f},\"tags\":[\"loot\",\"tier_%d\"]}"),
+			Index, Index, Index * 1.25f, (Index & 1) ? TEXT("true") : TEXT("false"), Index * 0.5f, Index * -0.25f, Index * 2.f, Index % 5);
+		++Index;
+	}
+
+	Body += FString::Printf(TEXT("],\"total\":%d}"), Index);
+	return Body;
+}
+
+const TArray<uint8>& FJsonLoopbackServer::GetBody(int32 Size, bool& bGzip)
+{
+	// Handlers run on the ticking thread, the cache does not need a lock
+	const TPair<int32, bool> Key(Size, bGzip);
+	if (const TArray<uint8>* Cached = BodyCache.Find(Key)) {
+		return *Cached;
+	}
+	if (bGzip && CompressionFailures.Contains(Size)) {
+		bGzip = false;
+		return GetBody(Size, bGzip);
+	}
+
+	const FString Text = MakeCannedBody(Size);
+	FTCHARToUTF8 Utf8(*Text);
+
+	TArray<uint8>& Body = BodyCache.Add(Key);
+	if (!bGzip) {
+		Body.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		return Body;
+	}
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Utf8.Length());
+	Body.SetNumUninitialized(CompressedSize);
+	if (FCompression::CompressMemory(NAME_Gzip, Body.GetData(), CompressedSize, Utf8.Get(), Utf8.Length())) {
+		Body.SetNum(CompressedSize, false);
+	}
+	else {
+		UE_LOG(LogJson, Warning, TEXT("Loopback server: gzip compression failed, serving %d bytes uncompressed"), Utf8.Length());
+		BodyCache.Remove(Key);
+		CompressionFailures.Add(Size);
+		bGzip = false;
+		return GetBody(Size, bGzip);
+	}
+	return Body;
+}
+#endif
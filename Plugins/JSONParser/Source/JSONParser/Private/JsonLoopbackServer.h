@@ -0,0 +1,82 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_JSON_TOOLS
+#include "HttpRouteHandle.h"
+
+class IHttpRouter;
+
+/* Settings of the loopback server, every value can be overridden per request with the query string (?size=&latency=&gzip=) */
+struct FJsonLoopbackServerSettings
+{
+	/* Port to listen on, always bound to 127.0.0.1 */
+	uint32 Port = 18089;
+
+	/* Approximative size in bytes of the JSON body served */
+	int32 BodySize = 64 * 1024;
+
+	/* Delay before the response is sent */
+	float LatencySeconds = 0.f;
+
+	/* Serve the body gzip compressed (Content-Encoding: gzip) */
+	bool bGzip = false;
+};
+
+/**
+* Local HTTP server serving canned JSON documents.
+* Only meant to measure the HTTP actions without a real backend, it never leaves the loopback interface.
+*/
+class FJsonLoopbackServer
+{
+public:
+	explicit FJsonLoopbackServer(const FJsonLoopbackServerSettings& InSettings);
+	~FJsonLoopbackServer();
+
+	/* Binds the /json route and starts the listeners */
+	bool Start();
+
+	/* Unbinds the route, the listeners of other servers keep running */
+	void Stop();
+
+	/* URL of the JSON route */
+	FString GetURL() const;
+
+	/* Number of requests answered since Start */
+	int32 GetRequestCount() const { return RequestCount; }
+
+	/* Builds a JSON document of roughly ApproxSize bytes made of records */
+	static FString MakeCannedBody(int32 ApproxSize);
+
+private:
+	/* Returns the cached encoded body, bGzip is cleared when the compression is not available */
+	const TArray<uint8>& GetBody(int32 Size, bool& bGzip);
+
+	FJsonLoopbackServerSettings Settings;
+	TSharedPtr<IHttpRouter> Router;
+	FHttpRouteHandle RouteHandle;
+
+	/* Encoded bodies, keyed by size and compression */
+	TMap<TPair<int32, bool>, TArray<uint8>> BodyCache;
+	TSet<int32> CompressionFailures;
+
+	TAtomic<int32> RequestCount;
+	bool bStarted = false;
+};
+#endif
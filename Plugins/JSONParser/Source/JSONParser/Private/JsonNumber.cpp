@@ -0,0 +1,721 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonNumber.h"
+#include "JsonValueType.h"
+
+namespace JsonNumber
+{
+	/* Little endian big number, only wide enough to build the tables of powers once at startup */
+	struct FBigNumber
+	{
+		uint32 Words[64] = {};
+		int32 Num = 1;
+
+		void MulSmall(uint32 Factor)
+		{
+			uint64 Carry = 0;
+			for (int32 Index = 0; Index < Num; ++Index) {
+				const uint64 Product = (uint64)Words[Index] * Factor + Carry;
+				Words[Index] = (uint32)Product;
+				Carry = Product >> 32;
+			}
+			if (Carry) {
+				Words[Num++] = (uint32)Carry;
+			}
+		}
+
+		void DivSmall(uint32 Divisor)
+		{
+			uint64 Remainder = 0;
+			for (int32 Index = Num - 1; Index >= 0; --Index) {
+				const uint64 Current = (Remainder << 32) | Words[Index];
+				Words[Index] = (uint32)(Current / Divisor);
+				Remainder = Current % Divisor;
+			}
+			while (Num > 1 && Words[Num - 1] == 0) {
+				--Num;
+			}
+		}
+
+		int32 BitLength() const
+		{
+			return Num * 32 - (int32)FMath::CountLeadingZeros(Words[Num - 1]);
+		}
+
+		bool GetBit(int32 Bit) const
+		{
+			return Bit >= 0 && ((Words[Bit / 32] >> (Bit % 32)) & 1);
+		}
+
+		void AddOne()
+		{
+			for (int32 Index = 0; Index < Num; ++Index) {
+				if (++Words[Index] != 0) {
+					return;
+				}
+			}
+			Words[Num++] = 1;
+		}
+
+		/* floor(this / 2^Shift) */
+		FBigNumber ShiftedRight(int32 Shift) const
+		{
+			FBigNumber Result;
+			const int32 WordShift = Shift / 32;
+			const int32 BitShift = Shift % 32;
+			Result.Num = FMath::Max(1, Num - WordShift);
+			for (int32 Index = 0; Index < Result.Num && Index + WordShift < Num; ++Index) {
+				uint64 Pair = Words[Index + WordShift];
+				if (Index + WordShift + 1 < Num) {
+					Pair |= (uint64)Words[Index + WordShift + 1] << 32;
+				}
+				Result.Words[Index] = (uint32)(Pair >> BitShift);
+			}
+			while (Result.Num > 1 && Result.Words[Result.Num - 1] == 0) {
+				--Result.Num;
+			}
+			return Result;
+		}
+
+		/* Upper 128 bits truncated, values shorter than 128 bits are shifted up */
+		void TopBits128(uint64& Hi, uint64& Lo) const
+		{
+			const int32 Length = BitLength();
+			Hi = 0;
+			Lo = 0;
+			for (int32 Bit = Length - 1; Bit >= Length - 128; --Bit) {
+				Hi = (Hi << 1) | (Lo >> 63);
+				Lo = (Lo << 1) | (GetBit(Bit) ? 1 : 0);
+			}
+		}
+
+		/* Upper 64 bits rounded to nearest, Exponent receives the binary exponent of the lowest kept bit */
+		uint64 TopBits(int32& Exponent) const
+		{
+			const int32 Length = BitLength();
+			uint64 Result = 0;
+			for (int32 Bit = Length - 1; Bit >= Length - 64; --Bit) {
+				Result = (Result << 1) | (GetBit(Bit) ? 1 : 0);
+			}
+			Exponent = Length - 64;
+			if (GetBit(Length - 65) && ++Result == 0) {
+				Result = uint64(1) << 63;
+				++Exponent;
+			}
+			return Result;
+		}
+	};
+
+	/**
+	 * Grisu2 (Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers").
+	 * The output always reads back to the input and is the shortest representation for almost every double.
+	 */
+	namespace Grisu
+	{
+		/* A value F * 2^E with a 64 bit significand */
+		struct FDiyFp
+		{
+			uint64 F;
+			int32 E;
+		};
+
+		/* The cached power of ten F * 2^E ~= 10^K */
+		struct FCachedPower
+		{
+			uint64 F;
+			int32 E;
+			int32 K;
+		};
+
+		/* Range of the binary exponent of the scaled value, digits are generated with 32 bit integer arithmetic */
+		static constexpr int32 Alpha = -60;
+		static constexpr int32 Gamma = -32;
+
+		static constexpr int32 MinCachedExponent = -300;
+		static constexpr int32 CachedExponentStep = 8;
+		static constexpr int32 NumCachedPowers = 81;
+
+		static FDiyFp Sub(const FDiyFp& X, const FDiyFp& Y)
+		{
+			return { X.F - Y.F, X.E };
+		}
+
+		/* Product of the significands rounded to the upper 64 bits */
+		static FDiyFp Mul(const FDiyFp& X, const FDiyFp& Y)
+		{
+			const uint64 XLo = X.F & 0xFFFFFFFFu;
+			const uint64 XHi = X.F >> 32;
+			const uint64 YLo = Y.F & 0xFFFFFFFFu;
+			const uint64 YHi = Y.F >> 32;
+
+			const uint64 P0 = XLo * YLo;
+			const uint64 P1 = XLo * YHi;
+			const uint64 P2 = XHi * YLo;
+			const uint64 P3 = XHi * YHi;
+
+			uint64 Mid = (P0 >> 32) + (P1 & 0xFFFFFFFFu) + (P2 & 0xFFFFFFFFu);
+			Mid += uint64(1) << 31;
+
+			return { P3 + (P2 >> 32) + (P1 >> 32) + (Mid >> 32), X.E + Y.E + 64 };
+		}
+
+		static FDiyFp Normalize(const FDiyFp& X)
+		{
+			const int32 Shift = (int32)FMath::CountLeadingZeros64(X.F);
+			return { X.F << Shift, X.E - Shift };
+		}
+
+		static FDiyFp NormalizeTo(const FDiyFp& X, int32 Exponent)
+		{
+			return { X.F << (X.E - Exponent), Exponent };
+		}
+
+		/* 10^K for K = -300, -292, ... 340, built once with exact arithmetic instead of a hardcoded table */
+		struct FCachedPowerTable
+		{
+			FCachedPower Entries[NumCachedPowers];
+
+			FCachedPowerTable()
+			{
+				for (int32 Index = 0; Index < NumCachedPowers; ++Index) {
+					const int32 K = MinCachedExponent + Index * CachedExponentStep;
+					FBigNumber Value;
+					int32 Exponent = 0;
+					if (K >= 0) {
+						Value.Words[0] = 1;
+						for (int32 Step = 0; Step < K; ++Step) {
+							Value.MulSmall(10);
+						}
+						Entries[Index].F = Value.TopBits(Exponent);
+						Entries[Index].E = Exponent;
+					}
+					else {
+						// floor(2^Shift / 10^-K) keeps more than 64 significant bits since 10 < 2^4
+						const int32 Shift = 4 * -K + 72;
+						Value.Num = Shift / 32 + 1;
+						Value.Words[Shift / 32] = 1u << (Shift % 32);
+						for (int32 Step = 0; Step < -K; ++Step) {
+							Value.DivSmall(10);
+						}
+						Entries[Index].F = Value.TopBits(Exponent);
+						Entries[Index].E = Exponent - Shift;
+					}
+					Entries[Index].K = K;
+				}
+			}
+		};
+
+		/* A power of ten which brings the binary exponent E into [Alpha, Gamma] */
+		static const FCachedPower& GetCachedPower(int32 E)
+		{
+			static const FCachedPowerTable Table;
+
+			// ceil((Alpha - E - 1) * log10(2))
+			const int32 F = Alpha - E - 1;
+			const int32 K = (F * 78913) / (1 << 18) + (F > 0 ? 1 : 0);
+			const int32 Index = (-MinCachedExponent + K + (CachedExponentStep - 1)) / CachedExponentStep;
+			check(Index >= 0 && Index < NumCachedPowers);
+			return Table.Entries[Index];
+		}
+
+		static int32 FindLargestPow10(uint32 Value, uint32& Pow10)
+		{
+			static constexpr uint32 Powers[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+			int32 Digits = 10;
+			while (Digits > 1 && Value < Powers[Digits - 1]) {
+				--Digits;
+			}
+			Pow10 = Powers[Digits - 1];
+			return Digits;
+		}
+
+		/* Move the last digit towards the exact value while it stays inside the rounding interval */
+		static void Round(ANSICHAR* Digits, int32 Length, uint64 Distance, uint64 Delta, uint64 Rest, uint64 TenK)
+		{
+			while (Rest < Distance && Delta - Rest >= TenK
+				&& (Rest + TenK < Distance || Distance - Rest > Rest + TenK - Distance)) {
+				Digits[Length - 1]--;
+				Rest += TenK;
+			}
+		}
+
+		static void GenerateDigits(ANSICHAR* Digits, int32& Length, int32& DecimalExponent, const FDiyFp& MMinus, const FDiyFp& W, const FDiyFp& MPlus)
+		{
+			uint64 Delta = Sub(MPlus, MMinus).F;
+			uint64 Distance = Sub(MPlus, W).F;
+
+			const FDiyFp One = { uint64(1) << -MPlus.E, MPlus.E };
+			uint32 P1 = (uint32)(MPlus.F >> -One.E);
+			uint64 P2 = MPlus.F & (One.F - 1);
+
+			// Integral part
+			uint32 Pow10 = 0;
+			int32 N = FindLargestPow10(P1, Pow10);
+			while (N > 0) {
+				Digits[Length++] = (ANSICHAR)('0' + P1 / Pow10);
+				P1 %= Pow10;
+				--N;
+
+				const uint64 Rest = ((uint64)P1 << -One.E) + P2;
+				if (Rest <= Delta) {
+					DecimalExponent += N;
+					Round(Digits, Length, Distance, Delta, Rest, (uint64)Pow10 << -One.E);
+					return;
+				}
+				Pow10 /= 10;
+			}
+
+			// Fractional part
+			int32 M = 0;
+			for (;;) {
+				P2 *= 10;
+				Digits[Length++] = (ANSICHAR)('0' + (P2 >> -One.E));
+				P2 &= One.F - 1;
+				++M;
+				Delta *= 10;
+				Distance *= 10;
+				if (P2 <= Delta) {
+					break;
+				}
+			}
+			DecimalExponent -= M;
+			Round(Digits, Length, Distance, Delta, P2, One.F);
+		}
+
+		/* Digits and decimal exponent of a positive finite double */
+		static void Generate(double Value, ANSICHAR* Digits, int32& Length, int32& DecimalExponent)
+		{
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+			const uint64 HiddenBit = uint64(1) << 52;
+			const int32 BiasedExponent = (int32)(Bits >> 52);
+			const uint64 Fraction = Bits & (HiddenBit - 1);
+
+			const FDiyFp V = BiasedExponent == 0
+				? FDiyFp{ Fraction, 1 - 1075 }
+				: FDiyFp{ Fraction + HiddenBit, BiasedExponent - 1075 };
+
+			// Boundaries halfway to the neighbours, the lower one is closer at a power of two
+			const bool bLowerIsCloser = Fraction == 0 && BiasedExponent > 1;
+			const FDiyFp Plus = Normalize({ 2 * V.F + 1, V.E - 1 });
+			const FDiyFp Minus = NormalizeTo(bLowerIsCloser ? FDiyFp{ 4 * V.F - 1, V.E - 2 } : FDiyFp{ 2 * V.F - 1, V.E - 1 }, Plus.E);
+			const FDiyFp W = Normalize(V);
+
+			const FCachedPower& Cached = GetCachedPower(Plus.E);
+			const FDiyFp C = { Cached.F, Cached.E };
+
+			const FDiyFp ScaledW = Mul(W, C);
+			const FDiyFp ScaledMinus = Mul(Minus, C);
+			const FDiyFp ScaledPlus = Mul(Plus, C);
+
+			Length = 0;
+			DecimalExponent = -Cached.K;
+			GenerateDigits(Digits, Length, DecimalExponent, { ScaledMinus.F + 1, ScaledMinus.E }, ScaledW, { ScaledPlus.F - 1, ScaledPlus.E });
+		}
+	}
+
+	/* Fixed notation is used for decimal exponents in (MinFixedExponent, MaxFixedExponent] like JavaScript */
+	static constexpr int32 MinFixedExponent = -6;
+	static constexpr int32 MaxFixedExponent = 21;
+
+	static int32 FormatUnsigned(uint64 Value, TCHAR* Buffer)
+	{
+		TCHAR Reversed[20];
+		int32 Length = 0;
+		do {
+			Reversed[Length++] = (TCHAR)('0' + Value % 10);
+			Value /= 10;
+		} while (Value);
+
+		for (int32 Index = 0; Index < Length; ++Index) {
+			Buffer[Index] = Reversed[Length - 1 - Index];
+		}
+		return Length;
+	}
+
+	int32 FormatInteger(int64 Value, TCHAR* Buffer)
+	{
+		if (Value < 0) {
+			Buffer[0] = '-';
+			return 1 + FormatUnsigned(0 - (uint64)Value, Buffer + 1);
+		}
+		return FormatUnsigned((uint64)Value, Buffer);
+	}
+
+	int32 FormatDouble(double Value, int32 MaxDecimals, TCHAR* Buffer)
+	{
+		if (!FMath::IsFinite(Value)) {
+			Buffer[0] = 'n'; Buffer[1] = 'u'; Buffer[2] = 'l'; Buffer[3] = 'l';
+			return 4;
+		}
+
+		static constexpr double Pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17 };
+		if (MaxDecimals >= 0 && MaxDecimals < (int32)UE_ARRAY_COUNT(Pow10)) {
+			// Past 2^53 the scaled value has no fractional part left to round
+			const double Scaled = Value * Pow10[MaxDecimals];
+			if (FMath::Abs(Scaled) < (double)MaxExactInteger) {
+				Value = FMath::RoundHalfFromZero(Scaled) / Pow10[MaxDecimals];
+			}
+		}
+
+		int32 Position = 0;
+		if (Value < 0) {
+			Buffer[Position++] = '-';
+			Value = -Value;
+		}
+
+		if (Value < (double)MaxExactInteger && Value == (double)(uint64)Value) {
+			return Position + FormatUnsigned((uint64)Value, Buffer + Position);
+		}
+
+		ANSICHAR Digits[20];
+		int32 Length = 0;
+		int32 DecimalExponent = 0;
+		Grisu::Generate(Value, Digits, Length, DecimalExponent);
+
+		// The value is 0.Digits * 10^Point
+		const int32 Point = Length + DecimalExponent;
+		if (Length <= Point && Point <= MaxFixedExponent) {
+			for (int32 Index = 0; Index < Length; ++Index) {
+				Buffer[Position++] = Digits[Index];
+			}
+			for (int32 Index = Length; Index < Point; ++Index) {
+				Buffer[Position++] = '0';
+			}
+		}
+		else if (0 < Point && Point <= MaxFixedExponent) {
+			for (int32 Index = 0; Index < Length; ++Index) {
+				if (Index == Point) {
+					Buffer[Position++] = '.';
+				}
+				Buffer[Position++] = Digits[Index];
+			}
+		}
+		else if (MinFixedExponent < Point && Point <= 0) {
+			Buffer[Position++] = '0';
+			Buffer[Position++] = '.';
+			for (int32 Index = Point; Index < 0; ++Index) {
+				Buffer[Position++] = '0';
+			}
+			for (int32 Index = 0; Index < Length; ++Index) {
+				Buffer[Position++] = Digits[Index];
+			}
+		}
+		else {
+			Buffer[Position++] = Digits[0];
+			if (Length > 1) {
+				Buffer[Position++] = '.';
+				for (int32 Index = 1; Index < Length; ++Index) {
+					Buffer[Position++] = Digits[Index];
+				}
+			}
+			const int32 Exponent = Point - 1;
+			Buffer[Position++] = 'e';
+			Buffer[Position++] = Exponent < 0 ? '-' : '+';
+			Position += FormatUnsigned(FMath::Abs(Exponent), Buffer + Position);
+		}
+		return Position;
+	}
+
+	/**
+	 * Eisel-Lemire (Lemire, "Number Parsing at a Gigabyte per Second", without the fallback as shown by
+	 * Mushtak and Lemire). Converts W * 10^Q to the nearest double using a 128 bit approximation of 5^Q.
+	 */
+	namespace Lemire
+	{
+		static constexpr int32 SmallestPowerOfTen = -342;
+		static constexpr int32 LargestPowerOfTen = 308;
+		static constexpr int32 MantissaBits = 52;
+		static constexpr int32 MinimumExponent = -1023;
+		static constexpr int32 InfinitePower = 0x7FF;
+
+		/* 5^Q normalized to 128 bits for every Q, the reciprocals are rounded up */
+		struct FPowerOfFiveTable
+		{
+			uint64 Entries[2 * (LargestPowerOfTen - SmallestPowerOfTen + 1)];
+
+			FPowerOfFiveTable()
+			{
+				FBigNumber Power;
+				Power.Words[0] = 1;
+				for (int32 Q = 0; Q <= LargestPowerOfTen; ++Q) {
+					uint64* Entry = &Entries[2 * (Q - SmallestPowerOfTen)];
+					Power.TopBits128(Entry[0], Entry[1]);
+					Power.MulSmall(5);
+				}
+
+				// floor(2^Shift / 5^N) for every N, then rescaled to the precision each entry needs
+				constexpr int32 Shift = 1760;
+				FBigNumber Reciprocal;
+				Reciprocal.Num = Shift / 32 + 1;
+				Reciprocal.Words[Shift / 32] = 1u << (Shift % 32);
+				FBigNumber FivePower;
+				FivePower.Words[0] = 1;
+				for (int32 N = 1; N <= -SmallestPowerOfTen; ++N) {
+					Reciprocal.DivSmall(5);
+					FivePower.MulSmall(5);
+
+					const int32 Z = FivePower.BitLength();
+					const int32 Bits = N <= 27 ? Z + 127 : 2 * Z + 128;
+					FBigNumber Value = Reciprocal.ShiftedRight(Shift - Bits);
+					Value.AddOne();
+
+					uint64* Entry = &Entries[2 * (-N - SmallestPowerOfTen)];
+					Value.TopBits128(Entry[0], Entry[1]);
+				}
+			}
+		};
+
+		static void Multiply(uint64 A, uint64 B, uint64& Hi, uint64& Lo)
+		{
+			const uint64 ALo = A & 0xFFFFFFFFu;
+			const uint64 AHi = A >> 32;
+			const uint64 BLo = B & 0xFFFFFFFFu;
+			const uint64 BHi = B >> 32;
+
+			const uint64 P0 = ALo * BLo;
+			const uint64 P1 = ALo * BHi;
+			const uint64 P2 = AHi * BLo;
+			const uint64 P3 = AHi * BHi;
+
+			const uint64 Mid = (P0 >> 32) + (P1 & 0xFFFFFFFFu) + (P2 & 0xFFFFFFFFu);
+			Lo = (Mid << 32) | (P0 & 0xFFFFFFFFu);
+			Hi = P3 + (P1 >> 32) + (P2 >> 32) + (Mid >> 32);
+		}
+
+		/* W must be non zero and exact, returns the bits of the double */
+		static uint64 Compute(uint64 W, int32 Q)
+		{
+			if (Q < SmallestPowerOfTen) {
+				return 0;
+			}
+			if (Q > LargestPowerOfTen) {
+				return uint64(InfinitePower) << MantissaBits;
+			}
+
+			static const FPowerOfFiveTable Table;
+			const uint64* Power = &Table.Entries[2 * (Q - SmallestPowerOfTen)];
+
+			const int32 LeadingZeros = (int32)FMath::CountLeadingZeros64(W);
+			W <<= LeadingZeros;
+
+			// Only the upper 55 bits matter, the second half of 5^Q is needed when they may carry
+			uint64 Hi, Lo;
+			Multiply(W, Power[0], Hi, Lo);
+			constexpr uint64 PrecisionMask = ~uint64(0) >> (MantissaBits + 3);
+			if ((Hi & PrecisionMask) == PrecisionMask) {
+				uint64 SecondHi, SecondLo;
+				Multiply(W, Power[1], SecondHi, SecondLo);
+				Lo += SecondHi;
+				if (SecondHi > Lo) {
+					++Hi;
+				}
+			}
+
+			const int32 UpperBit = (int32)(Hi >> 63);
+			uint64 Mantissa = Hi >> (UpperBit + 64 - MantissaBits - 3);
+			int32 Power2 = ((((152170 + 65536) * Q) >> 16) + 63) + UpperBit - LeadingZeros - MinimumExponent;
+
+			if (Power2 <= 0) {
+				// Subnormal, it may still round up to the smallest normal number
+				if (-Power2 + 1 >= 64) {
+					return 0;
+				}
+				Mantissa >>= -Power2 + 1;
+				Mantissa += Mantissa & 1;
+				Mantissa >>= 1;
+				Power2 = Mantissa < (uint64(1) << MantissaBits) ? 0 : 1;
+				return Mantissa | (uint64(Power2) << MantissaBits);
+			}
+
+			// Exactly halfway between two doubles, round to even
+			if (Lo <= 1 && Q >= -4 && Q <= 23 && (Mantissa & 3) == 1
+				&& (Mantissa << (UpperBit + 64 - MantissaBits - 3)) == Hi) {
+				Mantissa &= ~uint64(1);
+			}
+
+			Mantissa += Mantissa & 1;
+			Mantissa >>= 1;
+			if (Mantissa >= (uint64(2) << MantissaBits)) {
+				Mantissa = uint64(1) << MantissaBits;
+				++Power2;
+			}
+			Mantissa &= ~(uint64(1) << MantissaBits);
+
+			if (Power2 >= InfinitePower) {
+				return uint64(InfinitePower) << MantissaBits;
+			}
+			return Mantissa | (uint64(Power2) << MantissaBits);
+		}
+	}
+
+	static FORCEINLINE bool IsDigit(TCHAR Char)
+	{
+		return Char >= '0' && Char <= '9';
+	}
+
+	const TCHAR* ParseNumber(const TCHAR* Start, const TCHAR* End, FParsedNumber& OutNumber)
+	{
+		const TCHAR* Cursor = Start;
+		const bool bNegative = Cursor < End && *Cursor == '-';
+		if (bNegative) {
+			++Cursor;
+		}
+		if (Cursor >= End || !IsDigit(*Cursor)) {
+			return nullptr;
+		}
+
+		// Up to 19 significant digits fit in the mantissa, the remaining ones only matter for the fallback
+		uint64 Mantissa = 0;
+		int32 Digits = 0;
+		int32 Exponent = 0;
+		bool bTruncated = false;
+
+		if (*Cursor == '0') {
+			++Cursor;
+		}
+		else {
+			while (Cursor < End && IsDigit(*Cursor)) {
+				if (Digits < 19) {
+					Mantissa = Mantissa * 10 + (*Cursor - '0');
+					++Digits;
+				}
+				else {
+					++Exponent;
+					bTruncated |= *Cursor != '0';
+				}
+				++Cursor;
+			}
+		}
+
+		bool bIsInteger = true;
+		if (Cursor < End && *Cursor == '.') {
+			bIsInteger = false;
+			++Cursor;
+			if (Cursor >= End || !IsDigit(*Cursor)) {
+				return nullptr;
+			}
+			while (Cursor < End && IsDigit(*Cursor)) {
+				if (Digits < 19) {
+					Mantissa = Mantissa * 10 + (*Cursor - '0');
+					Digits += Mantissa != 0 ? 1 : 0;
+					--Exponent;
+				}
+				else {
+					bTruncated |= *Cursor != '0';
+				}
+				++Cursor;
+			}
+		}
+
+		if (Cursor < End && (*Cursor == 'e' || *Cursor == 'E')) {
+			bIsInteger = false;
+			++Cursor;
+			bool bNegativeExponent = false;
+			if (Cursor < End && (*Cursor == '+' || *Cursor == '-')) {
+				bNegativeExponent = *Cursor == '-';
+				++Cursor;
+			}
+			if (Cursor >= End || !IsDigit(*Cursor)) {
+				return nullptr;
+			}
+			int32 ExplicitExponent = 0;
+			while (Cursor < End && IsDigit(*Cursor)) {
+				// Anything past this is zero or infinity anyway
+				if (ExplicitExponent < 100000) {
+					ExplicitExponent = ExplicitExponent * 10 + (*Cursor - '0');
+				}
+				++Cursor;
+			}
+			Exponent += bNegativeExponent ? -ExplicitExponent : ExplicitExponent;
+		}
+
+		OutNumber.bIsInteger = false;
+		if (bIsInteger && !bTruncated && Exponent == 0) {
+			const uint64 Limit = bNegative ? uint64(1) << 63 : (uint64(1) << 63) - 1;
+			if (Mantissa <= Limit) {
+				OutNumber.bIsInteger = true;
+				OutNumber.Integer = bNegative ? (int64)(0 - Mantissa) : (int64)Mantissa;
+			}
+		}
+
+		static constexpr double Pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+		double Value;
+		if (bTruncated) {
+			Value = FCString::Atod(*FString((int32)(Cursor - Start), Start));
+			OutNumber.Value = Value;
+			return Cursor;
+		}
+		else if (Mantissa == 0) {
+			Value = 0;
+		}
+		else if (Mantissa <= (uint64(1) << 53) && Exponent >= -22 && Exponent <= 22) {
+			// Both operands are exact so the result is correctly rounded
+			Value = Exponent < 0 ? (double)Mantissa / Pow10[-Exponent] : (double)Mantissa * Pow10[Exponent];
+		}
+		else {
+			const uint64 Bits = Lemire::Compute(Mantissa, Exponent);
+			FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		}
+
+		OutNumber.Value = bNegative ? -Value : Value;
+		return Cursor;
+	}
+
+	bool ParseInteger(const FString& Text, int64& OutValue)
+	{
+		const TCHAR* Start = *Text;
+		const TCHAR* End = Start + Text.Len();
+
+		FParsedNumber Number;
+		if (ParseNumber(Start, End, Number) != End || !Number.bIsInteger) {
+			return false;
+		}
+		OutValue = Number.Integer;
+		return true;
+	}
+
+	bool TryGetInteger(const FJsonValue& Value, int64& OutValue)
+	{
+		// The strings and literals are read in place, copying them would allocate
+		if (Value.Type == EJson::String) {
+			return JsonValueType::IsString(Value) ? ParseInteger(JsonValueType::GetString(Value), OutValue) : ParseInteger(Value.AsString(), OutValue);
+		}
+		if (Value.Type != EJson::Number) {
+			return false;
+		}
+
+		// Past 2^53 only the literal is exact, the class is only looked up for those numbers
+		const double Number = Value.AsNumber();
+		if (FMath::Abs(Number) >= (double)MaxExactInteger && JsonValueType::IsNumberString(Value)) {
+			return ParseInteger(JsonValueType::GetNumberString(Value), OutValue);
+		}
+
+		if (Number != FMath::TruncToDouble(Number)) {
+			return false;
+		}
+
+		// Doubles this large are integers already, the ones out of the int64 range are refused
+		if (Number < -9223372036854775808.0 || Number >= 9223372036854775808.0) {
+			return false;
+		}
+		OutValue = (int64)Number;
+		return true;
+	}
+}
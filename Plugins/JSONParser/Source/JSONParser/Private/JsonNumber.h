@@ -0,0 +1,66 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+
+namespace JsonNumber
+{
+	/* Size of a buffer large enough for any number written by FormatDouble */
+	static constexpr int32 MaxFormattedLength = 32;
+
+	/* 2^53, every integer up to this magnitude is exact in a double */
+	static constexpr int64 MaxExactInteger = int64(1) << 53;
+
+	/**
+	 * Write the shortest decimal string that reads back to the same double.
+	 * Integral values up to 2^53 take a plain integer path, non-finite values are written as null.
+	 * A MaxDecimals >= 0 rounds the value to that many decimal places first.
+	 * Returns the number of characters written, the buffer is not null terminated.
+	 */
+	int32 FormatDouble(double Value, int32 MaxDecimals, TCHAR* Buffer);
+
+	/* Write an integer, returns the number of characters written */
+	int32 FormatInteger(int64 Value, TCHAR* Buffer);
+
+	struct FParsedNumber
+	{
+		double Value = 0;
+
+		/* Exact value when the token is an integer literal which fits in int64 */
+		int64 Integer = 0;
+		bool bIsInteger = false;
+	};
+
+	/**
+	 * Parse a number token following the strict JSON grammar.
+	 * Short decimals take the exact Clinger fast path, the others Eisel-Lemire, and only tokens with more than
+	 * 19 significant digits fall back to the C runtime.
+	 * Returns the end of the token, nullptr if the input does not start with a valid number.
+	 */
+	const TCHAR* ParseNumber(const TCHAR* Start, const TCHAR* End, FParsedNumber& OutNumber);
+
+	/* Parse a whole string as an integer literal, returns false if it is not one or does not fit in int64 */
+	bool ParseInteger(const FString& Text, int64& OutValue);
+
+	/**
+	 * Exact integer held by a value: integral numbers, integer literals kept past 2^53 as FJsonValueNumberString
+	 * and strings holding an integer literal. Returns false for fractions and other types.
+	 */
+	bool TryGetInteger(const FJsonValue& Value, int64& OutValue);
+}
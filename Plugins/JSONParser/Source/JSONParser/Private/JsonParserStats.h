@@ -0,0 +1,88 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformString.h"
+#include "Containers/StringView.h"
+
+DECLARE_STATS_GROUP(TEXT("JSONParser"), STATGROUP_JSONParser, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Parse"), STAT_JsonParse, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Serialize"), STAT_JsonSerialize, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Event Parse"), STAT_JsonEventParse, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Binary Read"), STAT_JsonBinaryRead, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Binary Write"), STAT_JsonBinaryWrite, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Compress"), STAT_JsonCompress, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Uncompress"), STAT_JsonUncompress, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Property To JSON"), STAT_JsonPropertyToJson, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("JSON To Property"), STAT_JsonJsonToProperty, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Texture Decode"), STAT_JsonTextureDecode, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Texture Encode"), STAT_JsonTextureEncode, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Request"), STAT_JsonAsyncRequest, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Response"), STAT_JsonAsyncResponse, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async File Read"), STAT_JsonAsyncFileRead, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async File Write"), STAT_JsonAsyncFileWrite, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Completed"), STAT_JsonAsyncCompleted, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("World Capture"), STAT_JsonWorldCapture, STATGROUP_JSONParser, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("World Encode"), STAT_JsonWorldEncode, STATGROUP_JSONParser, );
+
+// Counters are cleared every frame, they read as bytes per frame in 'stat JSONParser'. Text counts its UTF-8 size, as
+// it would be sent or stored, binary its encoded size
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Parsed"), STAT_JsonBytesParsed, STATGROUP_JSONParser, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Written"), STAT_JsonBytesWritten, STATGROUP_JSONParser, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Compressed"), STAT_JsonBytesCompressed, STATGROUP_JSONParser, );
+
+// Running totals for Insights, visible in the Counters panel with the 'counters' channel
+TRACE_DECLARE_INT_COUNTER_EXTERN(JsonTotalBytesParsed);
+TRACE_DECLARE_INT_COUNTER_EXTERN(JsonTotalBytesWritten);
+
+// Every allocation made while building, parsing or serializing a document is tagged, see 'stat LLM' / 'stat LLMFULL'
+LLM_DECLARE_TAG(JSONParser);
+
+/* Cycle counter when stats are compiled in (it also emits the Insights event), CPU profiler event otherwise */
+#if STATS
+#define JSON_SCOPE_CYCLE_COUNTER(Stat) SCOPE_CYCLE_COUNTER(Stat)
+#else
+#define JSON_SCOPE_CYCLE_COUNTER(Stat) TRACE_CPUPROFILER_EVENT_SCOPE(Stat)
+#endif
+
+#define JSON_COUNT_BYTES_PARSED(Bytes) \
+	INC_DWORD_STAT_BY(STAT_JsonBytesParsed, Bytes); \
+	TRACE_COUNTER_ADD(JsonTotalBytesParsed, Bytes)
+
+#define JSON_COUNT_BYTES_WRITTEN(Bytes) \
+	INC_DWORD_STAT_BY(STAT_JsonBytesWritten, Bytes); \
+	TRACE_COUNTER_ADD(JsonTotalBytesWritten, Bytes)
+
+/* Size of a text once encoded in UTF-8 */
+FORCEINLINE int32 JsonUtf8Length(FStringView Text)
+{
+	return FPlatformString::ConvertedLength<UTF8CHAR>(Text.GetData(), Text.Len());
+}
+
+/* Byte counters of TCHAR text, the UTF-8 size is only computed when a counter is compiled in */
+#if STATS || COUNTERSTRACE_ENABLED
+#define JSON_COUNT_TEXT_PARSED(Text) { const int32 JsonTextBytes = JsonUtf8Length(Text); JSON_COUNT_BYTES_PARSED(JsonTextBytes); }
+#define JSON_COUNT_TEXT_WRITTEN(Text) { const int32 JsonTextBytes = JsonUtf8Length(Text); JSON_COUNT_BYTES_WRITTEN(JsonTextBytes); }
+#else
+#define JSON_COUNT_TEXT_PARSED(Text)
+#define JSON_COUNT_TEXT_WRITTEN(Text)
+#endif
@@ -0,0 +1,104 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonProjection.h"
+
+FJsonProjection::FJsonProjection(const TArray<FString>& Paths)
+{
+	TArray<FString> Names;
+	for (const FString& Path : Paths) {
+		Names.Reset();
+		Path.ParseIntoArray(Names, TEXT("."));
+		if (Names.Num() == 0) {
+			continue;
+		}
+
+		int32 Node = Root;
+		for (FString& Name : Names) {
+			Name.TrimStartAndEndInline();
+			Node = FindOrAddChild(Node, Name);
+		}
+		Nodes[Node].bKeepAll = true;
+	}
+	ResolveWildcards(Root);
+}
+
+int32 FJsonProjection::Find(int32 Node, const FString& Key) const
+{
+	if (Node == KeepAll) {
+		return KeepAll;
+	}
+
+	const FNode& Parent = Nodes[Node];
+	const int32* Found = Parent.Children.Find(Key);
+	const int32 Child = Found ? *Found : Parent.Wildcard;
+	return Child != Skip && Nodes[Child].bKeepAll ? KeepAll : Child;
+}
+
+int32 FJsonProjection::AddNode()
+{
+	return Nodes.AddDefaulted();
+}
+
+int32 FJsonProjection::FindOrAddChild(int32 Node, const FString& Name)
+{
+	const bool bWildcard = Name == TEXT("*");
+	const int32* Found = bWildcard ? nullptr : Nodes[Node].Children.Find(Name);
+	int32 Child = bWildcard ? Nodes[Node].Wildcard : (Found ? *Found : Skip);
+	if (Child == Skip) {
+		// Adding a node can move the array, the parent is looked up again after
+		Child = AddNode();
+		if (bWildcard) {
+			Nodes[Node].Wildcard = Child;
+		}
+		else {
+			Nodes[Node].Children.Add(Name, Child);
+		}
+	}
+	return Child;
+}
+
+void FJsonProjection::Merge(int32 Target, int32 Source)
+{
+	if (Nodes[Source].bKeepAll) {
+		Nodes[Target].bKeepAll = true;
+	}
+
+	const TArray<TPair<FString, int32>> Children = Nodes[Source].Children.Array();
+	for (const TPair<FString, int32>& Child : Children) {
+		Merge(FindOrAddChild(Target, Child.Key), Child.Value);
+	}
+	if (Nodes[Source].Wildcard != Skip) {
+		Merge(FindOrAddChild(Target, TEXT("*")), Nodes[Source].Wildcard);
+	}
+}
+
+void FJsonProjection::ResolveWildcards(int32 Node)
+{
+	// "a.x" and "*.y" both apply to the field a, the reader only follows one node per value
+	const int32 Wildcard = Nodes[Node].Wildcard;
+	TArray<int32> Children;
+	Nodes[Node].Children.GenerateValueArray(Children);
+	for (const int32 Child : Children) {
+		if (Wildcard != Skip) {
+			Merge(Child, Wildcard);
+		}
+		ResolveWildcards(Child);
+	}
+	if (Wildcard != Skip) {
+		ResolveWildcards(Wildcard);
+	}
+}
@@ -0,0 +1,88 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonRecordArray.h"
+#include "JsonParserStats.h"
+#include "JsonValueType.h"
+#include "Misc/ScopeLock.h"
+
+const TCHAR* FJsonValueRecordArray::TypeName = TEXT("RecordArray");
+
+TAtomic<int32> FJsonValueRecordArray::NumLive { 0 };
+
+FJsonValueRecordArray::FJsonValueRecordArray(const TSharedRef<const FJsonShape>& InShape, FSlots&& InSlots, int32 InNumRecords)
+	: Shape(InShape)
+	, NumRecords(InNumRecords)
+	, Slots(MakeShared<FSlots>(MoveTemp(InSlots)))
+{
+	Type = EJson::Array;
+	check(Slots->Num() == NumRecords * Shape->Num());
+	++NumLive;
+}
+
+FJsonValueRecordArray::~FJsonValueRecordArray()
+{
+	--NumLive;
+}
+
+TSharedPtr<const FJsonValueRecordArray::FSlots> FJsonValueRecordArray::PinSlots() const
+{
+	if (bMaterialized) {
+		return nullptr;
+	}
+	FScopeLock Lock(&MaterializeLock);
+	return Slots;
+}
+
+bool FJsonValueRecordArray::TryGetArray(const TArray<TSharedPtr<FJsonValue>>*& OutArray) const
+{
+	if (!bMaterialized) {
+		FScopeLock Lock(&MaterializeLock);
+		if (!bMaterialized) {
+			LLM_SCOPE_BYTAG(JSONParser);
+			Materialized.Reserve(NumRecords);
+			for (int32 Index = 0; Index < NumRecords; ++Index) {
+				Materialized.Add(MakeShared<FJsonValueObject>(MakeObject(*Shape, GetRecord(*Slots, Index))));
+			}
+			bMaterialized = true;
+
+			// The objects share the values, only the flat array goes. Readers which pinned it keep their reference
+			Slots.Reset();
+		}
+	}
+
+	OutArray = &Materialized;
+	return true;
+}
+
+TSharedRef<FJsonObject> FJsonValueRecordArray::MakeObject(const FJsonShape& Shape, const TSharedPtr<FJsonValue>* Record)
+{
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+	Object->Values.Reserve(Shape.Num());
+	for (int32 Slot = 0; Slot < Shape.Num(); ++Slot) {
+		Object->Values.Add(Shape.Keys[Slot], Record[Slot]);
+	}
+	return Object;
+}
+
+const FJsonValueRecordArray* FJsonValueRecordArray::Cast(const FJsonValue& Value)
+{
+	// The value being read is alive, so a count of zero rules it out; the name is only built while record arrays exist
+	if (Value.Type != EJson::Array || NumLive.Load(EMemoryOrder::Relaxed) == 0 || JsonValueType::GetName(Value) != TypeName) {
+		return nullptr;
+	}
+	return static_cast<const FJsonValueRecordArray*>(&Value);
+}
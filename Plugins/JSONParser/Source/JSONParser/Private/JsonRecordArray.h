@@ -0,0 +1,128 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeBool.h"
+
+/* Key table shared by every record of a record array */
+class FJsonShape
+{
+public:
+	/* Field names in slot order */
+	TArray<FString> Keys;
+
+	/* Slot of each field name, built once per shape */
+	TMap<FString, int32> Slots;
+
+	void Add(const FString& Key)
+	{
+		Slots.Add(Key, Keys.Add(Key));
+	}
+
+	int32 Find(const FString& Key) const
+	{
+		const int32* Slot = Slots.Find(Key);
+		return Slot ? *Slot : INDEX_NONE;
+	}
+
+	int32 Num() const
+	{
+		return Keys.Num();
+	}
+};
+
+/**
+ * An array of objects sharing the same keys, stored as one key table and a flat array of values.
+ * The reader produces it for arrays of homogeneous records, which saves a TMap and a copy of every key per record.
+ * Record views (UJsonFieldData::GetObjectArray) read the slots through the shape. It still reads as a regular array:
+ * the record objects are built the first time TryGetArray is called, under a lock so that snapshots can be read from
+ * several threads. The flat values are released once the objects are built, readers walking them pin them with
+ * PinSlots so that another thread building the objects meanwhile does not free them under the reader.
+ */
+class FJsonValueRecordArray : public FJsonValue
+{
+public:
+	/* Values of every record in slot order, never modified once the array is built */
+	using FSlots = TArray<TSharedPtr<FJsonValue>>;
+
+	FJsonValueRecordArray(const TSharedRef<const FJsonShape>& InShape, FSlots&& InSlots, int32 InNumRecords);
+	virtual ~FJsonValueRecordArray();
+
+	virtual bool TryGetArray(const TArray<TSharedPtr<FJsonValue>>*& OutArray) const override;
+
+	/* False once the record objects have been built */
+	bool IsFlat() const
+	{
+		return !bMaterialized;
+	}
+
+	/* The flat values, kept alive while the result is held. Null once the record objects have been built */
+	TSharedPtr<const FSlots> PinSlots() const;
+
+	const FJsonShape& GetShape() const
+	{
+		return *Shape;
+	}
+
+	const TSharedRef<const FJsonShape>& GetSharedShape() const
+	{
+		return Shape;
+	}
+
+	int32 Num() const
+	{
+		return NumRecords;
+	}
+
+	/* Values of a record in slot order, in slots pinned from this array */
+	const TSharedPtr<FJsonValue>* GetRecord(const FSlots& Slots, int32 Index) const
+	{
+		return Slots.GetData() + Index * Shape->Num();
+	}
+
+	/* The record array behind a value, nullptr for any other value */
+	static const FJsonValueRecordArray* Cast(const FJsonValue& Value);
+
+	/* Build a regular object from the values of a record */
+	static TSharedRef<FJsonObject> MakeObject(const FJsonShape& Shape, const TSharedPtr<FJsonValue>* Record);
+
+	static const TCHAR* TypeName;
+
+protected:
+	virtual FString GetType() const override
+	{
+		return TypeName;
+	}
+
+private:
+	TSharedRef<const FJsonShape> Shape;
+	int32 NumRecords;
+
+	/* Released under the lock once Materialized is published */
+	mutable TSharedPtr<const FSlots> Slots;
+
+	mutable TArray<TSharedPtr<FJsonValue>> Materialized;
+	mutable FThreadSafeBool bMaterialized;
+	mutable FCriticalSection MaterializeLock;
+
+	/* Record arrays alive, while there are none Cast returns without building the type name */
+	static TAtomic<int32> NumLive;
+};
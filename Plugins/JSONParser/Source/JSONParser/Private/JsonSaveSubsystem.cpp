@@ -0,0 +1,322 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonSaveSubsystem.h"
+#include "JsonBinary.h"
+#include "JsonFieldData.h"
+#include "JsonGlobals.h"
+#include "JsonParserStats.h"
+#include "JsonTextWriter.h"
+
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+
+/* SaveGame properties of a class and their place in a staged record */
+struct FJsonSaveLayout
+{
+	struct FField
+	{
+		const FProperty* Property = nullptr;
+		FString Name;
+
+		/* Offset in the record, INDEX_NONE for the fields converted during the capture */
+		int32 Offset = INDEX_NONE;
+		bool bPlainData = false;
+	};
+
+	FString ClassPath;
+	TArray<FField> Fields;
+	int32 Size = 0;
+	bool bHasConverted = false;
+
+	explicit FJsonSaveLayout(const UClass* Class)
+		: ClassPath(Class->GetPathName())
+	{
+		for (FProperty* Property = Class->PropertyLink; Property; Property = Property->PropertyLinkNext) {
+			if (!Property->HasAllPropertyFlags(CPF_SaveGame)) {
+				continue;
+			}
+
+			FField& Field = Fields.AddDefaulted_GetRef();
+			Field.Property = Property;
+			Field.Name = Property->GetFName().ToString();
+			Field.bPlainData = Property->HasAnyPropertyFlags(CPF_IsPlainOldData);
+
+			// The objects behind a reference cannot be read from the workers
+			TArray<const FStructProperty*> EncounteredStructs;
+			if (Property->ContainsObjectReference(EncounteredStructs, EPropertyObjectReferenceType::Strong | EPropertyObjectReferenceType::Weak)) {
+				bHasConverted = true;
+				continue;
+			}
+
+			Size = Align(Size, Property->GetMinAlignment());
+			Field.Offset = Size;
+			Size += Property->GetSize();
+		}
+		Size = Align(Size, 16);
+	}
+};
+
+struct FJsonSaveRecord
+{
+	const FJsonSaveLayout* Layout = nullptr;
+	FString Name;
+	int64 Offset = 0;
+
+	/* Values of the fields converted during the capture, by field index */
+	TArray<TSharedPtr<FJsonValue>> Converted;
+};
+
+/* Everything a save needs once the capture is done, owned by the workers until the file is written */
+struct FJsonSaveBatch
+{
+	TMap<const UClass*, TUniquePtr<FJsonSaveLayout>> Layouts;
+	TArray<FJsonSaveRecord> Records;
+	TArray<uint8, TAlignedHeapAllocator<16>> Staging;
+
+	FString Filename;
+	bool bBinary = false;
+
+	~FJsonSaveBatch()
+	{
+		for (const FJsonSaveRecord& Record : Records) {
+			for (const FJsonSaveLayout::FField& Field : Record.Layout->Fields) {
+				if (Field.Offset != INDEX_NONE && !Field.bPlainData) {
+					Field.Property->DestroyValue(GetValue(Record, Field));
+				}
+			}
+		}
+	}
+
+	uint8* GetValue(const FJsonSaveRecord& Record, const FJsonSaveLayout::FField& Field)
+	{
+		return Staging.GetData() + Record.Offset + Field.Offset;
+	}
+
+	/* Value of a field, static arrays are written as arrays */
+	static TSharedPtr<FJsonValue> FieldToJson(const FProperty* Property, const void* Value)
+	{
+		if (Property->ArrayDim == 1) {
+			return UJsonFieldData::PropertyToJsonValue(Property, Value);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Elements;
+		Elements.Reserve(Property->ArrayDim);
+		for (int32 Index = 0; Index < Property->ArrayDim; Index++) {
+			Elements.Add(UJsonFieldData::PropertyToJsonValue(Property, (const uint8*)Value + Index * Property->ElementSize));
+		}
+		return MakeShared<FJsonValueArray>(MoveTemp(Elements));
+	}
+
+	TSharedPtr<FJsonObject> MakeObject(const FJsonSaveRecord& Record)
+	{
+		const FJsonSaveLayout& Layout = *Record.Layout;
+		TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->Values.Reserve(Layout.Fields.Num() + 1);
+		Object->SetStringField(TEXT("$class"), Layout.ClassPath);
+		for (int32 Index = 0; Index < Layout.Fields.Num(); Index++) {
+			const FJsonSaveLayout::FField& Field = Layout.Fields[Index];
+			Object->SetField(Field.Name, Field.Offset == INDEX_NONE ? Record.Converted[Index] : FieldToJson(Field.Property, GetValue(Record, Field)));
+		}
+		return Object;
+	}
+
+	/* Build one object per actor in parallel, then encode and write the file, worker thread */
+	bool Write()
+	{
+		JSON_SCOPE_CYCLE_COUNTER(STAT_JsonWorldEncode);
+		LLM_SCOPE_BYTAG(JSONParser);
+
+		TArray<TSharedPtr<FJsonObject>> Objects;
+		Objects.SetNum(Records.Num());
+		TArray<FString> Texts;
+		Texts.SetNum(bBinary ? 0 : Records.Num());
+
+		ParallelFor(Records.Num(), [this, &Objects, &Texts](int32 Index)
+		{
+			LLM_SCOPE_BYTAG(JSONParser);
+			Objects[Index] = MakeObject(Records[Index]);
+			if (!bBinary) {
+				Texts[Index] = UJsonFieldData::SerializeObject(Objects[Index], false);
+			}
+		});
+
+		if (bBinary) {
+			TSharedPtr<FJsonObject> Actors = MakeShared<FJsonObject>();
+			Actors->Values.Reserve(Records.Num());
+			for (int32 Index = 0; Index < Records.Num(); Index++) {
+				Actors->Values.Add(Records[Index].Name, MakeShared<FJsonValueObject>(Objects[Index]));
+			}
+			TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+			Root->SetObjectField(TEXT("actors"), Actors);
+
+			TArray<uint8> Binary;
+			FJsonBinary::Write(Root, Binary);
+			return FFileHelper::SaveArrayToFile(Binary, *Filename);
+		}
+
+		// The actors were serialized separately, only their keys are left to write
+		int32 Length = 16;
+		for (int32 Index = 0; Index < Records.Num(); Index++) {
+			Length += Records[Index].Name.Len() + Texts[Index].Len() + 4;
+		}
+
+		FString Text;
+		Text.Reserve(Length);
+		Text.Append(TEXT("{\"actors\":{"));
+		for (int32 Index = 0; Index < Records.Num(); Index++) {
+			if (Index) {
+				Text.AppendChar(',');
+			}
+			FJsonTextWriter::AppendString(Text, Records[Index].Name);
+			Text.AppendChar(':');
+			Text.Append(Texts[Index]);
+		}
+		Text.Append(TEXT("}}"));
+
+		return FFileHelper::SaveStringToFile(Text, *Filename);
+	}
+};
+
+void UJsonSaveSubsystem::Deinitialize()
+{
+	Actors.Reset();
+	Super::Deinitialize();
+}
+
+void UJsonSaveSubsystem::RegisterActor(AActor* Actor)
+{
+	if (IsValid(Actor)) {
+		Actors.AddUnique(Actor);
+	}
+}
+
+void UJsonSaveSubsystem::UnregisterActor(AActor* Actor)
+{
+	Actors.Remove(Actor);
+}
+
+bool UJsonSaveSubsystem::IsSaving() const
+{
+	return InFlight.IsValid();
+}
+
+/**
+* Copies the SaveGame properties of every registered actor into one staging buffer.
+* Records are laid out in a first pass so that the buffer is allocated once, values are then copied in place.
+*
+* @return	The captured batch
+*/
+TSharedRef<FJsonSaveBatch> UJsonSaveSubsystem::Capture()
+{
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonWorldCapture);
+	LLM_SCOPE_BYTAG(JSONParser);
+	TSharedRef<FJsonSaveBatch> Batch = MakeShared<FJsonSaveBatch>();
+
+	Actors.RemoveAll([](const TWeakObjectPtr<AActor>& Actor) { return !Actor.IsValid(); });
+
+	TArray<AActor*> Captured;
+	Captured.Reserve(Actors.Num());
+	Batch->Records.Reserve(Actors.Num());
+
+	int64 Size = 0;
+	for (const TWeakObjectPtr<AActor>& Weak : Actors) {
+		AActor* Actor = Weak.Get();
+		TUniquePtr<FJsonSaveLayout>& Layout = Batch->Layouts.FindOrAdd(Actor->GetClass());
+		if (!Layout) {
+			Layout = MakeUnique<FJsonSaveLayout>(Actor->GetClass());
+		}
+
+		FJsonSaveRecord& Record = Batch->Records.AddDefaulted_GetRef();
+		Record.Layout = Layout.Get();
+		Record.Name = Actor->GetPathName();
+		Record.Offset = Size;
+		Size += Layout->Size;
+		Captured.Add(Actor);
+	}
+
+	Batch->Staging.SetNumZeroed(Size);
+
+	for (int32 Index = 0; Index < Captured.Num(); Index++) {
+		const AActor* Actor = Captured[Index];
+		FJsonSaveRecord& Record = Batch->Records[Index];
+		const TArray<FJsonSaveLayout::FField>& Fields = Record.Layout->Fields;
+		if (Record.Layout->bHasConverted) {
+			Record.Converted.SetNum(Fields.Num());
+		}
+
+		for (int32 FieldIndex = 0; FieldIndex < Fields.Num(); FieldIndex++) {
+			const FJsonSaveLayout::FField& Field = Fields[FieldIndex];
+			const void* Source = Field.Property->ContainerPtrToValuePtr<void>(Actor);
+			if (Field.Offset == INDEX_NONE) {
+				Record.Converted[FieldIndex] = FJsonSaveBatch::FieldToJson(Field.Property, Source);
+				continue;
+			}
+
+			uint8* Destination = Batch->GetValue(Record, Field);
+			if (Field.bPlainData) {
+				FMemory::Memcpy(Destination, Source, Field.Property->GetSize());
+			}
+			else {
+				Field.Property->InitializeValue(Destination);
+				Field.Property->CopyCompleteValue(Destination, Source);
+			}
+		}
+	}
+
+	return Batch;
+}
+
+/**
+* Captures the registered actors on the game thread, then converts and writes them on worker threads
+*
+* @param	Filename		Destination file
+* @param	bBinary			Write the compact binary format instead of text
+* @param	OnSaved			Called on the game thread once the file is written
+*
+* @return	False if a save is already running
+*/
+bool UJsonSaveSubsystem::SaveWorld(const FString& Filename, bool bBinary, const FOnJsonWorldSaved& OnSaved)
+{
+	if (InFlight.IsValid()) {
+		UE_LOG(LogJson, Warning, TEXT("Save to '%s' ignored, a world save is already running"), *Filename);
+		return false;
+	}
+
+	TSharedRef<FJsonSaveBatch> Batch = Capture();
+	Batch->Filename = Filename;
+	Batch->bBinary = bBinary;
+	InFlight = Batch;
+
+	TWeakObjectPtr<UJsonSaveSubsystem> WeakThis(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Batch, WeakThis, OnSaved]()
+	{
+		const bool bSuccess = Batch->Write();
+
+		AsyncTask(ENamedThreads::GameThread, [Batch, WeakThis, OnSaved, bSuccess]()
+		{
+			JSON_SCOPE_CYCLE_COUNTER(STAT_JsonAsyncCompleted);
+			UJsonSaveSubsystem* This = WeakThis.Get();
+			if (This && This->InFlight == Batch) {
+				This->InFlight.Reset();
+			}
+			OnSaved.ExecuteIfBound(bSuccess);
+		});
+	});
+
+	return true;
+}
@@ -0,0 +1,614 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonSaxReader.h"
+#include "JsonGlobals.h"
+#include "JsonNumber.h"
+#include "JsonParserStats.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+namespace JsonSax
+{
+	/**
+	 * Tokenizer and grammar for one character type, TCHAR text or UTF-8 bytes.
+	 * Containers only push a flag on a heap stack, the depth does not depend on the thread stack.
+	 */
+	template<typename CharType>
+	class TLexer
+	{
+	public:
+		TLexer(const CharType* InStart, const CharType* InEnd, IJsonSaxHandler& InHandler, int32 InMaxDepth)
+			: Start(InStart)
+			, Cursor(InStart)
+			, End(InEnd)
+			, Handler(InHandler)
+			, MaxDepth(InMaxDepth)
+		{
+		}
+
+		EJsonSaxResult Run(FString* OutError)
+		{
+			if (Parse()) {
+				return EJsonSaxResult::Completed;
+			}
+			if (bAborted) {
+				return EJsonSaxResult::Aborted;
+			}
+			if (OutError) {
+				*OutError = MoveTemp(Error);
+			}
+			return EJsonSaxResult::Invalid;
+		}
+
+	private:
+		static constexpr bool bWide = sizeof(CharType) == sizeof(TCHAR);
+
+		bool Parse()
+		{
+			for (;;) {
+				// A value: at the root, after a key or in an array
+				SkipWhitespace();
+				if (Cursor >= End) {
+					return SetError(TEXT("unexpected end of input"));
+				}
+
+				switch (*Cursor) {
+				case '{':
+					++Cursor;
+					if (!Push(true) || !Emit(Handler.OnObjectStart())) {
+						return false;
+					}
+					SkipWhitespace();
+					if (Cursor < End && *Cursor == '}') {
+						++Cursor;
+						Scopes.Pop(false);
+						if (!Emit(Handler.OnObjectEnd())) {
+							return false;
+						}
+						break;
+					}
+					if (!ParseKey()) {
+						return false;
+					}
+					continue;
+				case '[':
+					++Cursor;
+					if (!Push(false) || !Emit(Handler.OnArrayStart())) {
+						return false;
+					}
+					SkipWhitespace();
+					if (Cursor < End && *Cursor == ']') {
+						++Cursor;
+						Scopes.Pop(false);
+						if (!Emit(Handler.OnArrayEnd())) {
+							return false;
+						}
+						break;
+					}
+					continue;
+				case '"':
+				{
+					FStringView Value;
+					if (!ParseString(Value) || !Emit(Handler.OnString(Value))) {
+						return false;
+					}
+					break;
+				}
+				case 't':
+					if (!ParseLiteral("true", 4) || !Emit(Handler.OnBool(true))) {
+						return false;
+					}
+					break;
+				case 'f':
+					if (!ParseLiteral("false", 5) || !Emit(Handler.OnBool(false))) {
+						return false;
+					}
+					break;
+				case 'n':
+					if (!ParseLiteral("null", 4) || !Emit(Handler.OnNull())) {
+						return false;
+					}
+					break;
+				default:
+					if (!ParseNumber()) {
+						return false;
+					}
+					break;
+				}
+
+				// After a value: close the containers which end here, up to the separator of the next value
+				for (;;) {
+					SkipWhitespace();
+					if (Scopes.Num() == 0) {
+						return Cursor == End || SetError(TEXT("unexpected data after the root value"));
+					}
+					if (Cursor >= End) {
+						return SetError(TEXT("unexpected end of input"));
+					}
+
+					const bool bObject = Scopes.Last();
+					const CharType Char = *Cursor;
+					if (Char == ',') {
+						++Cursor;
+						if (bObject && !ParseKey()) {
+							return false;
+						}
+						break;
+					}
+					if (Char != (bObject ? '}' : ']')) {
+						return SetError(bObject ? TEXT("expected ',' or '}'") : TEXT("expected ',' or ']'"));
+					}
+					++Cursor;
+					Scopes.Pop(false);
+					if (!Emit(bObject ? Handler.OnObjectEnd() : Handler.OnArrayEnd())) {
+						return false;
+					}
+				}
+			}
+		}
+
+		FORCEINLINE void SkipWhitespace()
+		{
+			while (Cursor < End && (*Cursor == ' ' || *Cursor == '\n' || *Cursor == '\r' || *Cursor == '\t')) {
+				++Cursor;
+			}
+		}
+
+		FORCEINLINE bool Emit(bool bContinue)
+		{
+			bAborted = !bContinue;
+			return bContinue;
+		}
+
+		bool Push(bool bObject)
+		{
+			if (Scopes.Num() >= MaxDepth) {
+				return SetError(TEXT("nesting is too deep"));
+			}
+			Scopes.Add(bObject);
+			return true;
+		}
+
+		bool ParseKey()
+		{
+			SkipWhitespace();
+			if (Cursor >= End || *Cursor != '"') {
+				return SetError(TEXT("expected a field name"));
+			}
+
+			FStringView Key;
+			if (!ParseString(Key) || !Emit(Handler.OnKey(Key))) {
+				return false;
+			}
+
+			SkipWhitespace();
+			if (Cursor >= End || *Cursor != ':') {
+				return SetError(TEXT("expected ':'"));
+			}
+			++Cursor;
+			return true;
+		}
+
+		bool ParseLiteral(const ANSICHAR* Literal, int32 Length)
+		{
+			if (End - Cursor < Length) {
+				return SetError(TEXT("unknown literal"));
+			}
+			for (int32 Index = 0; Index < Length; ++Index) {
+				if (Cursor[Index] != Literal[Index]) {
+					return SetError(TEXT("unknown literal"));
+				}
+			}
+			Cursor += Length;
+			return true;
+		}
+
+		bool ParseNumber()
+		{
+			const CharType* TokenStart = Cursor;
+			while (Cursor < End && ((*Cursor >= '0' && *Cursor <= '9') || *Cursor == '-' || *Cursor == '+' || *Cursor == '.' || *Cursor == 'e' || *Cursor == 'E')) {
+				++Cursor;
+			}
+			const int32 Length = (int32)(Cursor - TokenStart);
+
+			// Numbers are ASCII, UTF-8 tokens are widened before the shared number parser
+			const TCHAR* Text;
+			if constexpr (bWide) {
+				Text = reinterpret_cast<const TCHAR*>(TokenStart);
+			}
+			else {
+				Scratch.Reset();
+				for (const CharType* Char = TokenStart; Char < Cursor; ++Char) {
+					Scratch.AppendChar((TCHAR)*Char);
+				}
+				Text = *Scratch;
+			}
+
+			JsonNumber::FParsedNumber Number;
+			if (Length == 0 || JsonNumber::ParseNumber(Text, Text + Length, Number) != Text + Length) {
+				Cursor = TokenStart;
+				return SetError(TEXT("invalid value"));
+			}
+			return Emit(Handler.OnNumber(Number.Value, FStringView(Text, Length)));
+		}
+
+		bool ParseString(FStringView& OutValue)
+		{
+			// Skip the opening quote
+			++Cursor;
+
+			bool bCopied = false;
+			const CharType* Run = Cursor;
+			for (;;) {
+				while (Cursor < End && *Cursor != '"' && *Cursor != '\\') {
+					++Cursor;
+				}
+				if (Cursor >= End) {
+					return SetError(TEXT("unterminated string"));
+				}
+
+				// Text without escapes is handed over in place
+				if constexpr (bWide) {
+					if (!bCopied && *Cursor == '"') {
+						OutValue = FStringView(reinterpret_cast<const TCHAR*>(Run), (int32)(Cursor - Run));
+						++Cursor;
+						return true;
+					}
+				}
+
+				if (!bCopied) {
+					Scratch.Reset();
+					bCopied = true;
+				}
+				AppendRun(Run, Cursor);
+
+				if (*Cursor == '"') {
+					++Cursor;
+					OutValue = FStringView(*Scratch, Scratch.Len());
+					return true;
+				}
+
+				// Escape sequence
+				++Cursor;
+				if (Cursor >= End) {
+					return SetError(TEXT("unterminated string"));
+				}
+				switch (*Cursor++) {
+				case '"': Scratch.AppendChar('"'); break;
+				case '\\': Scratch.AppendChar('\\'); break;
+				case '/': Scratch.AppendChar('/'); break;
+				case 'b': Scratch.AppendChar('\b'); break;
+				case 'f': Scratch.AppendChar('\f'); break;
+				case 'n': Scratch.AppendChar('\n'); break;
+				case 'r': Scratch.AppendChar('\r'); break;
+				case 't': Scratch.AppendChar('\t'); break;
+				case 'u':
+				{
+					if (End - Cursor < 4) {
+						return SetError(TEXT("invalid unicode escape"));
+					}
+					uint32 CodeUnit = 0;
+					for (int32 Index = 0; Index < 4; ++Index) {
+						const CharType Char = *Cursor++;
+						if (!FChar::IsHexDigit((TCHAR)Char)) {
+							return SetError(TEXT("invalid unicode escape"));
+						}
+						CodeUnit = (CodeUnit << 4) | FParse::HexDigit((TCHAR)Char);
+					}
+					// TCHAR is UTF-16, surrogate pairs are kept as two code units
+					Scratch.AppendChar((TCHAR)CodeUnit);
+					break;
+				}
+				default:
+					--Cursor;
+					return SetError(TEXT("invalid escape sequence"));
+				}
+				Run = Cursor;
+			}
+		}
+
+		/* Appends characters which need no unescaping to Scratch, decoding UTF-8 input */
+		void AppendRun(const CharType* Begin, const CharType* RunEnd)
+		{
+			if constexpr (bWide) {
+				Scratch.AppendChars(reinterpret_cast<const TCHAR*>(Begin), (int32)(RunEnd - Begin));
+			}
+			else {
+				while (Begin < RunEnd) {
+					const uint32 Lead = (uint8)*Begin++;
+					if (Lead < 0x80) {
+						Scratch.AppendChar((TCHAR)Lead);
+						continue;
+					}
+
+					const int32 Trail = Lead >= 0xF0 ? 3 : Lead >= 0xE0 ? 2 : Lead >= 0xC0 ? 1 : 0;
+					uint32 CodePoint = Lead & (0x3F >> Trail);
+					bool bValid = Trail > 0 && Lead < 0xF8 && RunEnd - Begin >= Trail;
+					for (int32 Index = 0; bValid && Index < Trail; ++Index) {
+						const uint32 Byte = (uint8)Begin[Index];
+						bValid = (Byte & 0xC0) == 0x80;
+						CodePoint = (CodePoint << 6) | (Byte & 0x3F);
+					}
+					if (!bValid || CodePoint > 0x10FFFF) {
+						// Invalid sequences are replaced, one character per bad lead byte
+						Scratch.AppendChar((TCHAR)0xFFFD);
+						continue;
+					}
+					Begin += Trail;
+
+					if (CodePoint >= 0x10000) {
+						CodePoint -= 0x10000;
+						Scratch.AppendChar((TCHAR)(0xD800 + (CodePoint >> 10)));
+						Scratch.AppendChar((TCHAR)(0xDC00 + (CodePoint & 0x3FF)));
+					}
+					else {
+						Scratch.AppendChar((TCHAR)CodePoint);
+					}
+				}
+			}
+		}
+
+		bool SetError(const TCHAR* Message)
+		{
+			// Line and column are only computed on failure
+			int64 Line = 1;
+			int64 Column = 1;
+			for (const CharType* Char = Start; Char < Cursor && Char < End; ++Char) {
+				if (*Char == '\n') {
+					++Line;
+					Column = 1;
+				}
+				else {
+					++Column;
+				}
+			}
+			Error = FString::Printf(TEXT("Invalid JSON at line %lld, column %lld: %s"), Line, Column, Message);
+			return false;
+		}
+
+		const CharType* Start;
+		const CharType* Cursor;
+		const CharType* End;
+		IJsonSaxHandler& Handler;
+		const int32 MaxDepth;
+
+		/* Open containers, true for objects */
+		TArray<bool, TInlineAllocator<64>> Scopes;
+
+		/* Strings which cannot be handed over in place, reused by every token */
+		FString Scratch;
+
+		FString Error;
+		bool bAborted = false;
+	};
+}
+
+/**
+* Reads a document as a sequence of events
+*
+* @param	Text		The document
+* @param	Handler		Receives the events
+* @param	OutError	Set when the document is invalid
+* @param	MaxDepth	Documents nested deeper are rejected
+*
+* @return	Completed, Aborted by the handler or Invalid
+*/
+EJsonSaxResult FJsonSax::Parse(FStringView Text, IJsonSaxHandler& Handler, FString* OutError, int32 MaxDepth)
+{
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonEventParse);
+	LLM_SCOPE_BYTAG(JSONParser);
+	JSON_COUNT_TEXT_PARSED(Text);
+
+	JsonSax::TLexer<TCHAR> Lexer(Text.GetData(), Text.GetData() + Text.Len(), Handler, MaxDepth);
+	return Lexer.Run(OutError);
+}
+
+/**
+* Reads a UTF-8 document as a sequence of events
+*
+* @param	Data		The document
+* @param	Size		Size of the document in bytes
+* @param	Handler		Receives the events
+* @param	OutError	Set when the document is invalid
+* @param	MaxDepth	Documents nested deeper are rejected
+*
+* @return	Completed, Aborted by the handler or Invalid
+*/
+EJsonSaxResult FJsonSax::ParseUtf8(const UTF8CHAR* Data, int64 Size, IJsonSaxHandler& Handler, FString* OutError, int32 MaxDepth)
+{
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonEventParse);
+	LLM_SCOPE_BYTAG(JSONParser);
+	JSON_COUNT_BYTES_PARSED(Size);
+
+	const UTF8CHAR* End = Data + Size;
+	if (Size >= 3 && (uint8)Data[0] == 0xEF && (uint8)Data[1] == 0xBB && (uint8)Data[2] == 0xBF) {
+		Data += 3;
+	}
+
+	JsonSax::TLexer<UTF8CHAR> Lexer(Data, End, Handler, MaxDepth);
+	return Lexer.Run(OutError);
+}
+
+/**
+* Reads a UTF-8 file as a sequence of events. The file is mapped rather than loaded when the platform allows it,
+* so that only the pages being read are resident
+*
+* @param	Filename	The file
+* @param	Handler		Receives the events
+* @param	OutError	Set when the file cannot be read or is invalid
+* @param	MaxDepth	Documents nested deeper are rejected
+*
+* @return	Completed, Aborted by the handler or Invalid
+*/
+EJsonSaxResult FJsonSax::ParseFile(const FString& Filename, IJsonSaxHandler& Handler, FString* OutError, int32 MaxDepth)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IMappedFileHandle> Mapped(PlatformFile.OpenMapped(*Filename));
+	if (Mapped.IsValid()) {
+		const int64 Size = Mapped->GetFileSize();
+		if (Size == 0) {
+			return ParseUtf8(nullptr, 0, Handler, OutError, MaxDepth);
+		}
+		TUniquePtr<IMappedFileRegion> Region(Mapped->MapRegion(0, Size));
+		if (Region.IsValid()) {
+			return ParseUtf8(reinterpret_cast<const UTF8CHAR*>(Region->GetMappedPtr()), Region->GetMappedSize(), Handler, OutError, MaxDepth);
+		}
+	}
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename)) {
+		if (OutError) {
+			*OutError = FString::Printf(TEXT("Cannot read '%s'"), *Filename);
+		}
+		return EJsonSaxResult::Invalid;
+	}
+	return ParseUtf8(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData()), Bytes.Num(), Handler, OutError, MaxDepth);
+}
+
+/// <summary>
+/// ////////////////
+/// </summary>
+class FJsonSaxReaderHandler : public IJsonSaxHandler
+{
+public:
+	explicit FJsonSaxReaderHandler(UJsonSaxReader& InReader)
+		: Reader(InReader)
+	{
+	}
+
+	virtual bool OnObjectStart() override
+	{
+		++Reader.Depth;
+		Reader.OnObjectStart.Broadcast();
+		return !Reader.bAbort;
+	}
+
+	virtual bool OnObjectEnd() override
+	{
+		--Reader.Depth;
+		Reader.OnObjectEnd.Broadcast();
+		return !Reader.bAbort;
+	}
+
+	virtual bool OnArrayStart() override
+	{
+		++Reader.Depth;
+		Reader.OnArrayStart.Broadcast();
+		return !Reader.bAbort;
+	}
+
+	virtual bool OnArrayEnd() override
+	{
+		--Reader.Depth;
+		Reader.OnArrayEnd.Broadcast();
+		return !Reader.bAbort;
+	}
+
+	virtual bool OnKey(FStringView Key) override
+	{
+		// Strings are only built for the events someone listens to
+		if (Reader.OnKey.IsBound()) {
+			Reader.OnKey.Broadcast(FString(Key));
+		}
+		return !Reader.bAbort;
+	}
+
+	virtual bool OnString(FStringView Value) override
+	{
+		if (Reader.OnString.IsBound()) {
+			Reader.OnString.Broadcast(FString(Value));
+		}
+		return !Reader.bAbort;
+	}
+
+	virtual bool OnNumber(double Value, FStringView Literal) override
+	{
+		Reader.OnNumber.Broadcast(Value);
+		return !Reader.bAbort;
+	}
+
+	virtual bool OnBool(bool Value) override
+	{
+		Reader.OnBool.Broadcast(Value);
+		return !Reader.bAbort;
+	}
+
+	virtual bool OnNull() override
+	{
+		Reader.OnNull.Broadcast();
+		return !Reader.bAbort;
+	}
+
+private:
+	UJsonSaxReader& Reader;
+};
+
+/**
+* Create a new event reader, for use in Blueprint graphs
+*
+* @param	WorldContextObject		The current context
+*
+* @return	The reader
+*/
+UJsonSaxReader* UJsonSaxReader::Create(UObject* WorldContextObject)
+{
+	return NewObject<UJsonSaxReader>(WorldContextObject);
+}
+
+void UJsonSaxReader::BeginParse()
+{
+	bAbort = false;
+	Depth = 0;
+	Error.Reset();
+}
+
+EJsonSaxResult UJsonSaxReader::ParseString(const FString& Text)
+{
+	BeginParse();
+	FJsonSaxReaderHandler Handler(*this);
+	return FJsonSax::Parse(Text, Handler, &Error, MaxDepth);
+}
+
+EJsonSaxResult UJsonSaxReader::ParseBytes(const TArray<uint8>& Bytes)
+{
+	BeginParse();
+	FJsonSaxReaderHandler Handler(*this);
+	return FJsonSax::ParseUtf8(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData()), Bytes.Num(), Handler, &Error, MaxDepth);
+}
+
+EJsonSaxResult UJsonSaxReader::ParseFile(const FString& Filename)
+{
+	BeginParse();
+	FJsonSaxReaderHandler Handler(*this);
+	return FJsonSax::ParseFile(Filename, Handler, &Error, MaxDepth);
+}
+
+void UJsonSaxReader::Abort()
+{
+	bAbort = true;
+}
+
+int32 UJsonSaxReader::GetDepth() const
+{
+	return Depth;
+}
+
+FString UJsonSaxReader::GetError() const
+{
+	return Error;
+}
@@ -0,0 +1,240 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonStreamWriter.h"
+#include "JsonFieldData.h"
+#include "JsonGlobals.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryWriter.h"
+
+/**
+* Create a writer streaming to a file, the file is replaced
+*
+* @param	WorldContextObject	The current context
+* @param	Filename			File to write
+* @param	MaxDecimals			Number of decimals kept for numbers, negative for the shortest exact form
+*
+* @return	The writer, null if the file cannot be created
+*/
+UJsonStreamWriter* UJsonStreamWriter::CreateFileWriter(UObject* WorldContextObject, const FString& Filename, int32 MaxDecimals)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	FArchive* FileArchive = IFileManager::Get().CreateFileWriter(*Filename);
+	if (!FileArchive) {
+		UE_LOG(LogJson, Warning, TEXT("JSON stream: cannot create '%s'"), *Filename);
+		return nullptr;
+	}
+
+	UJsonStreamWriter* Writer = NewObject<UJsonStreamWriter>(WorldContextObject);
+	Writer->Filename = Filename;
+	Writer->Open(FileArchive, MaxDecimals);
+	return Writer;
+}
+
+/**
+* Create a writer collecting the document in memory
+*
+* @param	WorldContextObject	The current context
+* @param	MaxDecimals			Number of decimals kept for numbers, negative for the shortest exact form
+*
+* @return	The writer
+*/
+UJsonStreamWriter* UJsonStreamWriter::CreateBufferWriter(UObject* WorldContextObject, int32 MaxDecimals)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	UJsonStreamWriter* Writer = NewObject<UJsonStreamWriter>(WorldContextObject);
+	Writer->Open(new FMemoryWriter(Writer->Bytes), MaxDecimals);
+	return Writer;
+}
+
+void UJsonStreamWriter::Open(FArchive* InArchive, int32 MaxDecimals)
+{
+	Archive.Reset(InArchive);
+	Builder = MakeUnique<FJsonBuilder>(*Archive, MaxDecimals < 0 ? -1 : MaxDecimals);
+}
+
+void UJsonStreamWriter::Fail(const TCHAR* Call, const TCHAR* Reason)
+{
+	UE_LOG(LogJson, Warning, TEXT("JSON stream: %s ignored, %s"), Call, Reason);
+	bFailed = true;
+}
+
+bool UJsonStreamWriter::BeginValue(const FString& Key, const TCHAR* Call)
+{
+	if (!Builder.IsValid()) {
+		Fail(Call, TEXT("the writer is closed"));
+		return false;
+	}
+	if (Builder->IsComplete()) {
+		Fail(Call, TEXT("the root value is already complete"));
+		return false;
+	}
+	if (Builder->IsInObject()) {
+		if (Key.IsEmpty()) {
+			Fail(Call, TEXT("values inside an object need a key"));
+			return false;
+		}
+		Builder->Key(Key);
+	}
+	return true;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::BeginObject(const FString& Key)
+{
+	if (BeginValue(Key, TEXT("Begin Object"))) {
+		Builder->BeginObject();
+	}
+	return this;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::EndObject()
+{
+	if (!Builder.IsValid() || !Builder->IsInObject()) {
+		Fail(TEXT("End Object"), TEXT("no object is open"));
+		return this;
+	}
+	Builder->EndObject();
+	return this;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::BeginArray(const FString& Key)
+{
+	if (BeginValue(Key, TEXT("Begin Array"))) {
+		Builder->BeginArray();
+	}
+	return this;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::EndArray()
+{
+	if (!Builder.IsValid() || Builder->GetDepth() == 0 || Builder->IsInObject()) {
+		Fail(TEXT("End Array"), TEXT("no array is open"));
+		return this;
+	}
+	Builder->EndArray();
+	return this;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::WriteString(const FString& Key, const FString& Value)
+{
+	if (BeginValue(Key, TEXT("Write String"))) {
+		Builder->Value(FStringView(Value));
+	}
+	return this;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::WriteNumber(const FString& Key, double Value)
+{
+	if (BeginValue(Key, TEXT("Write Number"))) {
+		Builder->Value(Value);
+	}
+	return this;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::WriteInteger(const FString& Key, int64 Value)
+{
+	if (BeginValue(Key, TEXT("Write Integer"))) {
+		Builder->Value(Value);
+	}
+	return this;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::WriteBool(const FString& Key, bool Value)
+{
+	if (BeginValue(Key, TEXT("Write Bool"))) {
+		Builder->Value(Value);
+	}
+	return this;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::WriteNull(const FString& Key)
+{
+	if (BeginValue(Key, TEXT("Write Null"))) {
+		Builder->Null();
+	}
+	return this;
+}
+
+UJsonStreamWriter* UJsonStreamWriter::WriteJson(const FString& Key, UJsonFieldData* Json)
+{
+	if (BeginValue(Key, TEXT("Write JSON"))) {
+		const TSharedPtr<FJsonObject> Object = Json ? Json->ReadObject() : nullptr;
+		if (Object.IsValid()) {
+			Builder->Value(*Object);
+		}
+		else {
+			Builder->Null();
+		}
+	}
+	return this;
+}
+
+/**
+* Write what is still buffered and close the output. Later calls do nothing and return the same result
+*
+* @return	True if a complete document was written
+*/
+bool UJsonStreamWriter::Close()
+{
+	if (!Builder.IsValid()) {
+		return !bFailed;
+	}
+
+	if (!Builder->IsComplete()) {
+		UE_LOG(LogJson, Warning, TEXT("JSON stream: closed with %d open objects or arrays"), Builder->GetDepth());
+		bFailed = true;
+	}
+	if (!Builder->Flush()) {
+		UE_LOG(LogJson, Warning, TEXT("JSON stream: failed to write '%s'"), *Filename);
+		bFailed = true;
+	}
+	BytesWritten = Builder->GetBytesWritten();
+	Builder.Reset();
+
+	if (!Archive->Close()) {
+		bFailed = true;
+	}
+	Archive.Reset();
+	return !bFailed;
+}
+
+FString UJsonStreamWriter::GetString() const
+{
+	FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+	return FString(Text.Length(), Text.Get());
+}
+
+TArray<uint8> UJsonStreamWriter::GetBytes() const
+{
+	return Bytes;
+}
+
+TArray<uint8> UJsonStreamWriter::TakeBytes()
+{
+	return MoveTemp(Bytes);
+}
+
+int64 UJsonStreamWriter::GetBytesWritten() const
+{
+	return Builder.IsValid() ? Builder->GetBytesWritten() : BytesWritten;
+}
+
+void UJsonStreamWriter::BeginDestroy()
+{
+	// A writer dropped without Close still releases its file
+	Close();
+	Super::BeginDestroy();
+}
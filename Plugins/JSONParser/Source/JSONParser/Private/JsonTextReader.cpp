@@ -0,0 +1,572 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonTextReader.h"
+#include "JsonNumber.h"
+#include "JsonRecordArray.h"
+#include "JsonTree.h"
+
+#include "Misc/Parse.h"
+
+FJsonTextReader::FJsonTextReader(const TCHAR* InStart, const TCHAR* InEnd, int32 InMaxDepth, const FJsonProjection* InProjection)
+	: Start(InStart)
+	, Cursor(InStart)
+	, End(InEnd)
+	, MaxDepth(InMaxDepth)
+	, Projection(InProjection && !InProjection->IsEmpty() ? InProjection : nullptr)
+{
+}
+
+FJsonTextReader::~FJsonTextReader()
+{
+	// A failed read leaves partial containers on the stack, possibly holding deep values
+	for (FFrame& Frame : Stack) {
+		JsonTree::Release(MoveTemp(Frame.Object));
+		JsonTree::Release(MoveTemp(Frame.Values));
+		JsonTree::Release(MoveTemp(Frame.Slots));
+	}
+}
+
+bool FJsonTextReader::ReadObject(const FString& Text, TSharedPtr<FJsonObject>& OutObject, FString* OutError, int32 MaxDepth, const FJsonProjection* Projection)
+{
+	FJsonTextReader Reader(*Text, *Text + Text.Len(), MaxDepth, Projection);
+
+	TSharedPtr<FJsonObject> Object;
+	Reader.SkipWhitespace();
+	bool bValid = Reader.Cursor < Reader.End && *Reader.Cursor == '{'
+		? Reader.ParseRoot(Object)
+		: Reader.SetError(TEXT("the root must be an object"));
+
+	if (bValid) {
+		Reader.SkipWhitespace();
+		if (Reader.Cursor != Reader.End) {
+			bValid = Reader.SetError(TEXT("unexpected data after the root object"));
+		}
+	}
+
+	if (!bValid) {
+		JsonTree::Release(MoveTemp(Object));
+		if (OutError) {
+			*OutError = MoveTemp(Reader.Error);
+		}
+		return false;
+	}
+
+	// The document being replaced can be as deep as the new one
+	Swap(OutObject, Object);
+	JsonTree::Release(MoveTemp(Object));
+	return true;
+}
+
+bool FJsonTextReader::SetError(const TCHAR* Message)
+{
+	// Line and column are only computed on failure
+	int32 Line = 1;
+	int32 Column = 1;
+	for (const TCHAR* Char = Start; Char < Cursor && Char < End; ++Char) {
+		if (*Char == '\n') {
+			++Line;
+			Column = 1;
+		}
+		else {
+			++Column;
+		}
+	}
+	Error = FString::Printf(TEXT("Invalid JSON at line %d, column %d: %s"), Line, Column, Message);
+	return false;
+}
+
+bool FJsonTextReader::ParseKey(FString& OutKey)
+{
+	OutKey.Reset();
+	SkipWhitespace();
+	if (Cursor >= End || *Cursor != '"') {
+		return SetError(TEXT("expected a field name"));
+	}
+	if (!ParseString(OutKey)) {
+		return false;
+	}
+
+	SkipWhitespace();
+	if (Cursor >= End || *Cursor != ':') {
+		return SetError(TEXT("expected ':' after the field name"));
+	}
+	++Cursor;
+	return true;
+}
+
+bool FJsonTextReader::ParseSeparator(const FFrame& Frame, TCHAR Close, bool& bOutClosed)
+{
+	SkipWhitespace();
+	if (Cursor < End && *Cursor == Close) {
+		++Cursor;
+		bOutClosed = true;
+		return true;
+	}
+
+	bOutClosed = false;
+	if (Frame.Count == 0 && !Frame.bSkipped) {
+		return true;
+	}
+	if (Cursor >= End || *Cursor != ',') {
+		return SetError(Close == '}' ? TEXT("expected ',' or '}'") : TEXT("expected ',' or ']'"));
+	}
+	++Cursor;
+	return true;
+}
+
+bool FJsonTextReader::PushFrame(FFrame::EKind Kind)
+{
+	if (Stack.Num() >= MaxDepth) {
+		return SetError(TEXT("nesting is too deep"));
+	}
+
+	// Skip the opening brace or bracket
+	++Cursor;
+
+	FFrame& Frame = Stack.AddDefaulted_GetRef();
+	Frame.Kind = Kind;
+	Frame.Node = NextNode;
+	if (Kind == FFrame::EKind::Object) {
+		Frame.Object = MakeShared<FJsonObject>();
+	}
+	else if (Kind == FFrame::EKind::Record) {
+		// The record is read into the slots of its array, right below
+		FFrame& Array = Stack[Stack.Num() - 2];
+		Frame.Base = Array.Slots.Num();
+		Array.Slots.AddDefaulted(Array.Shape->Num());
+	}
+	return true;
+}
+
+void FJsonTextReader::StopRecords(FFrame& Array)
+{
+	if (Array.Shape.IsValid()) {
+		Array.Values.Reserve(Array.NumRecords + 1);
+		for (int32 Index = 0; Index < Array.NumRecords; ++Index) {
+			Array.Values.Add(MakeShared<FJsonValueObject>(FJsonValueRecordArray::MakeObject(*Array.Shape, Array.Slots.GetData() + Index * Array.Shape->Num())));
+		}
+		Array.Shape.Reset();
+		Array.Slots.Empty();
+	}
+	Array.bRecords = false;
+}
+
+void FJsonTextReader::RecordToObject(FFrame& Record, FFrame& Array)
+{
+	// The fields read so far become a regular object, the array stops building records when it receives it
+	Record.Kind = FFrame::EKind::Object;
+	Record.Object = MakeShared<FJsonObject>();
+	for (int32 Slot = 0; Slot < Array.Shape->Num(); ++Slot) {
+		if (Array.Slots[Record.Base + Slot].IsValid()) {
+			Record.Object->Values.Add(Array.Shape->Keys[Slot], Array.Slots[Record.Base + Slot]);
+		}
+	}
+	Array.Slots.SetNum(Record.Base, false);
+	Array.Pending = FFrame::EPending::Value;
+}
+
+bool FJsonTextReader::ParseRoot(TSharedPtr<FJsonObject>& OutObject)
+{
+	Stack.Reserve(16);
+	NextNode = Projection ? FJsonProjection::Root : FJsonProjection::KeepAll;
+	if (!PushFrame(FFrame::EKind::Object)) {
+		return false;
+	}
+
+	// Each step hands the value just read to the frame on top, which then closes or asks for its next value.
+	// Containers push a frame instead of recursing, the depth only costs heap memory.
+	TSharedPtr<FJsonValue> Value;
+	bool bHasValue = false;
+	bool bSkipped = false;
+
+	for (;;) {
+		const int32 Top = Stack.Num() - 1;
+		FFrame& Frame = Stack[Top];
+		bool bClosed = false;
+
+		switch (Frame.Kind) {
+		case FFrame::EKind::Object:
+		{
+			if (bHasValue) {
+				Frame.Object->Values.Add(MoveTemp(Frame.Key), MoveTemp(Value));
+				++Frame.Count;
+				bHasValue = false;
+			}
+			if (!ParseSeparator(Frame, '}', bClosed)) {
+				return false;
+			}
+			if (bClosed) {
+				break;
+			}
+			if (!ParseKey(Frame.Key) || !SelectValue(Frame, &Frame.Key, bSkipped)) {
+				return false;
+			}
+			if (bSkipped) {
+				continue;
+			}
+			break;
+		}
+		case FFrame::EKind::Record:
+		{
+			FFrame& Array = Stack[Top - 1];
+			const FJsonShape& Shape = *Array.Shape;
+			if (bHasValue) {
+				Array.Slots[Frame.Base + Frame.Slot] = MoveTemp(Value);
+				++Frame.Count;
+				bHasValue = false;
+			}
+			if (!ParseSeparator(Frame, '}', bClosed)) {
+				return false;
+			}
+			if (bClosed) {
+				if (Frame.Count != Shape.Num()) {
+					RecordToObject(Frame, Array);
+				}
+				break;
+			}
+
+			// Keys are compared in place against the shape, they are only stored once per shape
+			if (!ParseKey(ScratchKey) || !SelectValue(Frame, &ScratchKey, bSkipped)) {
+				return false;
+			}
+			if (bSkipped) {
+				continue;
+			}
+			const int32 Slot = Frame.Count < Shape.Num() && Shape.Keys[Frame.Count].Equals(ScratchKey, ESearchCase::CaseSensitive)
+				? Frame.Count
+				: Shape.Find(ScratchKey);
+
+			if (Slot == INDEX_NONE || Array.Slots[Frame.Base + Slot].IsValid()) {
+				RecordToObject(Frame, Array);
+				Frame.Key = ScratchKey;
+			}
+			else {
+				Frame.Slot = Slot;
+			}
+			break;
+		}
+		case FFrame::EKind::Array:
+		{
+			if (bHasValue) {
+				if (Frame.Pending == FFrame::EPending::FirstRecord) {
+					// The first object gives the shape of the records
+					TSharedPtr<FJsonObject> First = Value->AsObject();
+					Frame.Shape = MakeShared<FJsonShape>();
+					Frame.Slots.Reserve(First->Values.Num());
+					for (auto& Pair : First->Values) {
+						Frame.Shape->Add(Pair.Key);
+						Frame.Slots.Add(MoveTemp(Pair.Value));
+					}
+					Frame.NumRecords = 1;
+				}
+				else if (Frame.Pending == FFrame::EPending::Record) {
+					++Frame.NumRecords;
+				}
+				else {
+					StopRecords(Frame);
+					Frame.Values.Add(MoveTemp(Value));
+				}
+				Value.Reset();
+				++Frame.Count;
+				bHasValue = false;
+			}
+			if (!ParseSeparator(Frame, ']', bClosed)) {
+				return false;
+			}
+			if (bClosed) {
+				break;
+			}
+			if (!SelectValue(Frame, nullptr, bSkipped)) {
+				return false;
+			}
+			if (bSkipped) {
+				continue;
+			}
+
+			// Objects are read as records sharing the keys of the first one, until an element does not match
+			SkipWhitespace();
+			if (Frame.bRecords && Cursor < End && *Cursor == '{') {
+				const bool bFirst = !Frame.Shape.IsValid();
+				Frame.Pending = bFirst ? FFrame::EPending::FirstRecord : FFrame::EPending::Record;
+				if (!PushFrame(bFirst ? FFrame::EKind::Object : FFrame::EKind::Record)) {
+					return false;
+				}
+				continue;
+			}
+			Frame.Pending = FFrame::EPending::Value;
+			break;
+		}
+		}
+
+		if (bClosed) {
+			// The frame is complete, its value goes to the frame below
+			FFrame& Closed = Stack[Top];
+			if (Closed.Kind == FFrame::EKind::Object) {
+				if (Top == 0) {
+					OutObject = MoveTemp(Closed.Object);
+					Stack.Reset();
+					return true;
+				}
+				Value = MakeShared<FJsonValueObject>(MoveTemp(Closed.Object));
+			}
+			else if (Closed.Kind == FFrame::EKind::Array) {
+				if (Closed.bRecords && Closed.NumRecords >= MinRecords) {
+					Closed.Slots.Shrink();
+					Value = MakeShared<FJsonValueRecordArray>(Closed.Shape.ToSharedRef(), MoveTemp(Closed.Slots), Closed.NumRecords);
+				}
+				else {
+					StopRecords(Closed);
+					Value = MakeShared<FJsonValueArray>(MoveTemp(Closed.Values));
+				}
+			}
+			Stack.Pop(false);
+			bHasValue = true;
+			continue;
+		}
+
+		// The frame needs a value
+		SkipWhitespace();
+		if (Cursor >= End) {
+			return SetError(TEXT("unexpected end of input"));
+		}
+		if (*Cursor == '{' || *Cursor == '[') {
+			if (!PushFrame(*Cursor == '{' ? FFrame::EKind::Object : FFrame::EKind::Array)) {
+				return false;
+			}
+			continue;
+		}
+		if (!ParseScalar(Value)) {
+			return false;
+		}
+		bHasValue = true;
+	}
+}
+
+bool FJsonTextReader::SelectValue(FFrame& Frame, const FString* Key, bool& bOutSkipped)
+{
+	bOutSkipped = false;
+	NextNode = Frame.Node;
+	if (NextNode == FJsonProjection::KeepAll) {
+		return true;
+	}
+
+	// Array elements stay on the node of their array
+	if (Key) {
+		NextNode = Projection->Find(Frame.Node, *Key);
+		if (NextNode == FJsonProjection::KeepAll) {
+			return true;
+		}
+	}
+
+	// A value before the end of its path is only kept if the path can go on inside it
+	SkipWhitespace();
+	if (NextNode != FJsonProjection::Skip && Cursor < End && (*Cursor == '{' || *Cursor == '[')) {
+		return true;
+	}
+	bOutSkipped = true;
+	Frame.bSkipped = true;
+	return SkipValue();
+}
+
+bool FJsonTextReader::SkipValue()
+{
+	// Only strings and brackets are followed, the content of a skipped value is not validated
+	SkipWhitespace();
+	const TCHAR* ValueStart = Cursor;
+	int32 Depth = 0;
+	while (Cursor < End) {
+		const TCHAR Char = *Cursor;
+		if (Char == '"') {
+			if (!SkipString()) {
+				return false;
+			}
+			if (Depth == 0) {
+				return true;
+			}
+			continue;
+		}
+		if (Char == '{' || Char == '[') {
+			++Depth;
+		}
+		else if (Char == '}' || Char == ']') {
+			if (Depth == 0) {
+				// End of a number or literal
+				break;
+			}
+			if (--Depth == 0) {
+				++Cursor;
+				return true;
+			}
+		}
+		else if (Depth == 0 && (Char == ',' || Char == ' ' || Char == '\n' || Char == '\r' || Char == '\t')) {
+			break;
+		}
+		++Cursor;
+	}
+
+	if (Depth > 0) {
+		return SetError(TEXT("unexpected end of input"));
+	}
+	if (Cursor == ValueStart) {
+		return SetError(TEXT("invalid value"));
+	}
+	return true;
+}
+
+bool FJsonTextReader::SkipString()
+{
+	// Skip the opening quote
+	++Cursor;
+	for (;;) {
+		while (Cursor < End && *Cursor != '"' && *Cursor != '\\') {
+			++Cursor;
+		}
+		if (Cursor >= End) {
+			return SetError(TEXT("unterminated string"));
+		}
+		if (*Cursor == '"') {
+			++Cursor;
+			return true;
+		}
+		// The escaped character cannot end the string
+		Cursor += 2;
+	}
+}
+
+bool FJsonTextReader::ParseScalar(TSharedPtr<FJsonValue>& OutValue)
+{
+	switch (*Cursor) {
+	case '"':
+	{
+		FString String;
+		if (!ParseString(String)) {
+			return false;
+		}
+		OutValue = MakeShared<FJsonValueString>(MoveTemp(String));
+		return true;
+	}
+	case 't':
+		if (!ParseLiteral(TEXT("true"), 4)) {
+			return false;
+		}
+		OutValue = MakeShared<FJsonValueBoolean>(true);
+		return true;
+	case 'f':
+		if (!ParseLiteral(TEXT("false"), 5)) {
+			return false;
+		}
+		OutValue = MakeShared<FJsonValueBoolean>(false);
+		return true;
+	case 'n':
+		if (!ParseLiteral(TEXT("null"), 4)) {
+			return false;
+		}
+		OutValue = MakeShared<FJsonValueNull>();
+		return true;
+	default:
+		return ParseNumber(OutValue);
+	}
+}
+
+bool FJsonTextReader::ParseLiteral(const TCHAR* Literal, int32 Length)
+{
+	if (End - Cursor < Length || FCString::Strncmp(Cursor, Literal, Length) != 0) {
+		return SetError(TEXT("unknown literal"));
+	}
+	Cursor += Length;
+	return true;
+}
+
+bool FJsonTextReader::ParseNumber(TSharedPtr<FJsonValue>& OutValue)
+{
+	const TCHAR* TokenStart = Cursor;
+	JsonNumber::FParsedNumber Number;
+	const TCHAR* TokenEnd = JsonNumber::ParseNumber(Cursor, End, Number);
+	if (!TokenEnd) {
+		return SetError(TEXT("invalid value"));
+	}
+	Cursor = TokenEnd;
+
+	// A double holds every integer up to 2^53, larger ids keep their literal to stay exact
+	if (Number.bIsInteger && (Number.Integer > JsonNumber::MaxExactInteger || Number.Integer < -JsonNumber::MaxExactInteger)) {
+		OutValue = MakeShared<FJsonValueNumberString>(FString((int32)(TokenEnd - TokenStart), TokenStart));
+	}
+	else {
+		OutValue = MakeShared<FJsonValueNumber>(Number.Value);
+	}
+	return true;
+}
+
+bool FJsonTextReader::ParseString(FString& OutString)
+{
+	// Skip the opening quote
+	++Cursor;
+
+	const TCHAR* Run = Cursor;
+	for (;;) {
+		// Characters are copied by runs, only escapes are handled one by one
+		while (Cursor < End && *Cursor != '"' && *Cursor != '\\') {
+			++Cursor;
+		}
+		if (Cursor >= End) {
+			return SetError(TEXT("unterminated string"));
+		}
+		OutString.AppendChars(Run, (int32)(Cursor - Run));
+
+		if (*Cursor == '"') {
+			++Cursor;
+			return true;
+		}
+
+		// Escape sequence
+		++Cursor;
+		if (Cursor >= End) {
+			return SetError(TEXT("unterminated string"));
+		}
+		switch (*Cursor++) {
+		case '"': OutString.AppendChar('"'); break;
+		case '\\': OutString.AppendChar('\\'); break;
+		case '/': OutString.AppendChar('/'); break;
+		case 'b': OutString.AppendChar('\b'); break;
+		case 'f': OutString.AppendChar('\f'); break;
+		case 'n': OutString.AppendChar('\n'); break;
+		case 'r': OutString.AppendChar('\r'); break;
+		case 't': OutString.AppendChar('\t'); break;
+		case 'u':
+		{
+			if (End - Cursor < 4) {
+				return SetError(TEXT("invalid unicode escape"));
+			}
+			uint32 CodeUnit = 0;
+			for (int32 Index = 0; Index < 4; ++Index) {
+				const TCHAR Char = *Cursor++;
+				if (!FChar::IsHexDigit(Char)) {
+					return SetError(TEXT("invalid unicode escape"));
+				}
+				CodeUnit = (CodeUnit << 4) | FParse::HexDigit(Char);
+			}
+			// TCHAR is UTF-16, surrogate pairs are kept as two code units
+			OutString.AppendChar((TCHAR)CodeUnit);
+			break;
+		}
+		default:
+			--Cursor;
+			return SetError(TEXT("invalid escape sequence"));
+		}
+		Run = Cursor;
+	}
+}
@@ -0,0 +1,135 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "JsonProjection.h"
+#include "JsonRecordArray.h"
+
+/**
+ * Reads a JSON document into an object tree.
+ * Replaces TJsonReader for the plugin input: numbers go through the JsonNumber fast paths, integer
+ * literals which do not fit in a double are kept exactly as FJsonValueNumberString and arrays of objects
+ * sharing the same keys become record arrays.
+ * With a projection, the fields outside it are stepped over by matching brackets and quotes, they are never built.
+ */
+class FJsonTextReader
+{
+public:
+	/* Parse a document whose root is an object, OutError receives the reason and position on failure */
+	static bool ReadObject(const FString& Text, TSharedPtr<FJsonObject>& OutObject, FString* OutError = nullptr, int32 MaxDepth = DefaultMaxDepth, const FJsonProjection* Projection = nullptr);
+
+	/* Nesting deeper than this is rejected, containers are read with a heap stack so the limit only bounds memory */
+	static constexpr int32 DefaultMaxDepth = 16384;
+
+	/* Arrays with at least this many objects sharing the same keys are stored as FJsonValueRecordArray */
+	static constexpr int32 MinRecords = 2;
+
+private:
+	/* An object or array being read, or an object being read into the record slots of the array below it */
+	struct FFrame
+	{
+		enum class EKind : uint8
+		{
+			Object,
+			Array,
+			Record,
+		};
+
+		/* What an array expects from the element being read */
+		enum class EPending : uint8
+		{
+			Value,
+			FirstRecord,
+			Record,
+		};
+
+		EKind Kind = EKind::Object;
+		EPending Pending = EPending::Value;
+
+		/* Fields or elements read so far */
+		int32 Count = 0;
+
+		/* Projection node of the container, and whether members were skipped, which still need separators */
+		int32 Node = FJsonProjection::KeepAll;
+		bool bSkipped = false;
+
+		/* Object: the object and the key of the value being read */
+		TSharedPtr<FJsonObject> Object;
+		FString Key;
+
+		/* Array: the values, and the records sharing the keys of the first object while bRecords */
+		TArray<TSharedPtr<FJsonValue>> Values;
+		TSharedPtr<FJsonShape> Shape;
+		TArray<TSharedPtr<FJsonValue>> Slots;
+		int32 NumRecords = 0;
+		bool bRecords = true;
+
+		/* Record: first slot of the record in the array, and the slot being read */
+		int32 Base = 0;
+		int32 Slot = INDEX_NONE;
+	};
+
+	FJsonTextReader(const TCHAR* InStart, const TCHAR* InEnd, int32 InMaxDepth, const FJsonProjection* InProjection);
+	~FJsonTextReader();
+
+	bool ParseRoot(TSharedPtr<FJsonObject>& OutObject);
+	bool PushFrame(FFrame::EKind Kind);
+
+	/* Consume the ',' before the next member, or the closing character */
+	bool ParseSeparator(const FFrame& Frame, TCHAR Close, bool& bOutClosed);
+	bool ParseKey(FString& OutKey);
+
+	/* Projection node of the next member of Frame, named Key in objects. The member is skipped when it is not kept */
+	bool SelectValue(FFrame& Frame, const FString* Key, bool& bOutSkipped);
+	bool SkipValue();
+	bool SkipString();
+
+	/* Turn the records read so far into objects, the array then holds regular values */
+	static void StopRecords(FFrame& Array);
+	static void RecordToObject(FFrame& Record, FFrame& Array);
+
+	bool ParseScalar(TSharedPtr<FJsonValue>& OutValue);
+	bool ParseString(FString& OutString);
+	bool ParseNumber(TSharedPtr<FJsonValue>& OutValue);
+	bool ParseLiteral(const TCHAR* Literal, int32 Length);
+
+	bool SetError(const TCHAR* Message);
+
+	FORCEINLINE void SkipWhitespace()
+	{
+		while (Cursor < End && (*Cursor == ' ' || *Cursor == '\n' || *Cursor == '\r' || *Cursor == '\t')) {
+			++Cursor;
+		}
+	}
+
+	const TCHAR* Start;
+	const TCHAR* Cursor;
+	const TCHAR* End;
+	const int32 MaxDepth;
+	const FJsonProjection* Projection;
+
+	/* Projection node of the next container pushed */
+	int32 NextNode = FJsonProjection::KeepAll;
+	TArray<FFrame> Stack;
+	FString Error;
+
+	/* Reused for the keys of records, which are not stored */
+	FString ScratchKey;
+};
@@ -0,0 +1,358 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonTextWriter.h"
+#include "JsonBytes.h"
+#include "JsonNumber.h"
+#include "JsonRecordArray.h"
+#include "JsonValueType.h"
+
+FJsonTextWriter::FJsonTextWriter(FString& InOut, bool bInPretty, int32 InMaxDecimals, int32 InMaxDepth)
+	: Out(InOut)
+	, bPretty(bInPretty)
+	, MaxDecimals(InMaxDecimals)
+	, MaxDepth(InMaxDepth)
+	, Indent(0)
+	, bTruncated(false)
+{
+}
+
+void FJsonTextWriter::AppendString(FString& Out, FStringView Value)
+{
+	Out.AppendChar('"');
+
+	const TCHAR* Start = Value.GetData();
+	const TCHAR* Current = Start;
+	const TCHAR* End = Start + Value.Len();
+	while (Current < End) {
+		const TCHAR Char = *Current;
+		if (Char >= 0x20 && Char != '"' && Char != '\\') {
+			++Current;
+			continue;
+		}
+
+		// Flush the run of characters which do not need escaping
+		Out.AppendChars(Start, (int32)(Current - Start));
+		switch (Char) {
+		case '"': Out.AppendChars(TEXT("\\\""), 2); break;
+		case '\\': Out.AppendChars(TEXT("\\\\"), 2); break;
+		case '\n': Out.AppendChars(TEXT("\\n"), 2); break;
+		case '\r': Out.AppendChars(TEXT("\\r"), 2); break;
+		case '\t': Out.AppendChars(TEXT("\\t"), 2); break;
+		case '\b': Out.AppendChars(TEXT("\\b"), 2); break;
+		case '\f': Out.AppendChars(TEXT("\\f"), 2); break;
+		default: Out += FString::Printf(TEXT("\\u%04x"), (uint32)Char); break;
+		}
+		Start = ++Current;
+	}
+	Out.AppendChars(Start, (int32)(End - Start));
+
+	Out.AppendChar('"');
+}
+
+void FJsonTextWriter::AppendNumber(FString& Out, double Value, int32 MaxDecimals)
+{
+	TCHAR Buffer[JsonNumber::MaxFormattedLength];
+	Out.AppendChars(Buffer, JsonNumber::FormatDouble(Value, MaxDecimals, Buffer));
+}
+
+bool FJsonTextWriter::IsShortValue(const FJsonValue& Value)
+{
+	return Value.Type == EJson::Number || Value.Type == EJson::Boolean || Value.Type == EJson::Null;
+}
+
+void FJsonTextWriter::WriteNewLine()
+{
+	Out.AppendChars(LINE_TERMINATOR, UE_ARRAY_COUNT(LINE_TERMINATOR) - 1);
+	for (int32 Tab = 0; Tab < Indent; ++Tab) {
+		Out.AppendChar('\t');
+	}
+}
+
+void FJsonTextWriter::WriteFieldStart(const FString& Key, const FJsonValue& Value, bool bFirst)
+{
+	if (!bFirst) {
+		Out.AppendChar(',');
+	}
+	if (bPretty) {
+		WriteNewLine();
+	}
+	AppendString(Out, Key);
+	Out.AppendChar(':');
+
+	// Same layout as the engine pretty writer, nested objects open on their own line
+	if (bPretty) {
+		if (Value.Type == EJson::Object) {
+			WriteNewLine();
+		}
+		else {
+			Out.AppendChar(' ');
+		}
+	}
+}
+
+bool FJsonTextWriter::WriteObject(const FJsonObject& Object)
+{
+	Stack.Reset();
+	Fields.Reset();
+	bTruncated = false;
+
+	PushObject(Object);
+	while (Stack.Num()) {
+		Step();
+	}
+	return !bTruncated;
+}
+
+void FJsonTextWriter::PushObject(const FJsonObject& Object)
+{
+	Out.AppendChar('{');
+	++Indent;
+
+	FFrame& Frame = Stack.AddDefaulted_GetRef();
+	Frame.Kind = FFrame::EKind::Object;
+	Frame.Begin = Frame.Index = Fields.Num();
+	for (const FField& Field : Object.Values) {
+		if (Field.Value.IsValid()) {
+			Fields.Add(&Field);
+		}
+	}
+	Frame.End = Fields.Num();
+}
+
+void FJsonTextWriter::PushArray(const TArray<TSharedPtr<FJsonValue>>& Values)
+{
+	Out.AppendChar('[');
+	++Indent;
+
+	FFrame& Frame = Stack.AddDefaulted_GetRef();
+	Frame.Kind = FFrame::EKind::Array;
+	Frame.Values = &Values;
+
+	// Pretty arrays holding only numbers, booleans and nulls stay on one line
+	if (bPretty) {
+		Frame.bInline = true;
+		for (const TSharedPtr<FJsonValue>& Value : Values) {
+			if (Value.IsValid() && !IsShortValue(*Value)) {
+				Frame.bInline = false;
+				break;
+			}
+		}
+	}
+}
+
+void FJsonTextWriter::PushRecords(const FJsonValueRecordArray& Records, TSharedPtr<const FJsonValueRecordArray::FSlots>&& Slots)
+{
+	// Same output as an array of objects, without building them
+	Out.AppendChar('[');
+	++Indent;
+
+	FFrame& Frame = Stack.AddDefaulted_GetRef();
+	Frame.Kind = FFrame::EKind::Records;
+	Frame.Records = &Records;
+	Frame.Slots = MoveTemp(Slots);
+}
+
+void FJsonTextWriter::Step()
+{
+	// The frame is not used after WriteValue, which can grow the stack
+	FFrame& Frame = Stack.Last();
+	switch (Frame.Kind) {
+	case FFrame::EKind::Object:
+		if (Frame.Index < Frame.End) {
+			const FField& Field = *Fields[Frame.Index++];
+			WriteFieldStart(Field.Key, *Field.Value, Frame.bFirst);
+			Frame.bFirst = false;
+			WriteValue(*Field.Value);
+			return;
+		}
+
+		--Indent;
+		if (bPretty && !Frame.bFirst) {
+			WriteNewLine();
+		}
+		Out.AppendChar('}');
+		Fields.SetNum(Frame.Begin, false);
+		break;
+
+	case FFrame::EKind::Array:
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Values = *Frame.Values;
+		while (Frame.Index < Values.Num() && !Values[Frame.Index].IsValid()) {
+			++Frame.Index;
+		}
+
+		if (Frame.Index < Values.Num()) {
+			if (!Frame.bFirst) {
+				Out.AppendChar(',');
+			}
+			Frame.bFirst = false;
+
+			if (bPretty) {
+				if (Frame.bInline) {
+					Out.AppendChar(' ');
+				}
+				else {
+					WriteNewLine();
+				}
+			}
+			WriteValue(*Values[Frame.Index++]);
+			return;
+		}
+
+		--Indent;
+		if (bPretty && !Frame.bFirst) {
+			if (Frame.bInline) {
+				Out.AppendChar(' ');
+			}
+			else {
+				WriteNewLine();
+			}
+		}
+		Out.AppendChar(']');
+		break;
+	}
+
+	case FFrame::EKind::Records:
+	{
+		const FJsonValueRecordArray& Records = *Frame.Records;
+		if (Frame.Slot == INDEX_NONE) {
+			if (Frame.Index < Records.Num()) {
+				// Open the next record
+				if (Frame.Index) {
+					Out.AppendChar(',');
+				}
+				if (bPretty) {
+					WriteNewLine();
+				}
+				Out.AppendChar('{');
+				++Indent;
+				Frame.Slot = 0;
+				Frame.bFirst = true;
+				return;
+			}
+
+			--Indent;
+			if (bPretty && Records.Num()) {
+				WriteNewLine();
+			}
+			Out.AppendChar(']');
+			break;
+		}
+
+		const FJsonShape& Shape = Records.GetShape();
+		const TSharedPtr<FJsonValue>* Record = Records.GetRecord(*Frame.Slots, Frame.Index);
+		while (Frame.Slot < Shape.Num() && !Record[Frame.Slot].IsValid()) {
+			++Frame.Slot;
+		}
+
+		if (Frame.Slot < Shape.Num()) {
+			const FJsonValue& Value = *Record[Frame.Slot];
+			WriteFieldStart(Shape.Keys[Frame.Slot++], Value, Frame.bFirst);
+			Frame.bFirst = false;
+			WriteValue(Value);
+			return;
+		}
+
+		// Close the record
+		--Indent;
+		if (bPretty && !Frame.bFirst) {
+			WriteNewLine();
+		}
+		Out.AppendChar('}');
+		Frame.Slot = INDEX_NONE;
+		++Frame.Index;
+		return;
+	}
+	}
+
+	Stack.Pop(false);
+}
+
+void FJsonTextWriter::WriteValue(const FJsonValue& Value)
+{
+	switch (Value.Type) {
+	case EJson::String:
+		if (JsonValueType::IsString(Value)) {
+			AppendString(Out, JsonValueType::GetString(Value));
+		}
+		else if (const FJsonValueBytes* Bytes = FJsonValueBytes::Cast(Value)) {
+			Bytes->AppendQuoted(Out);
+		}
+		else {
+			AppendString(Out, Value.AsString());
+		}
+		break;
+	case EJson::Number:
+	{
+		const double Number = Value.AsNumber();
+		int64 Integer;
+		if (FMath::Abs(Number) >= (double)JsonNumber::MaxExactInteger && JsonNumber::TryGetInteger(Value, Integer)) {
+			// Large ids read from text keep their exact literal
+			TCHAR Buffer[JsonNumber::MaxFormattedLength];
+			Out.AppendChars(Buffer, JsonNumber::FormatInteger(Integer, Buffer));
+		}
+		else {
+			AppendNumber(Out, Number, MaxDecimals);
+		}
+		break;
+	}
+	case EJson::Boolean:
+		if (Value.AsBool()) {
+			Out.AppendChars(TEXT("true"), 4);
+		}
+		else {
+			Out.AppendChars(TEXT("false"), 5);
+		}
+		break;
+	case EJson::Array:
+	{
+		if (Stack.Num() >= MaxDepth) {
+			bTruncated = true;
+			Out.AppendChars(TEXT("null"), 4);
+			break;
+		}
+
+		const FJsonValueRecordArray* Records = FJsonValueRecordArray::Cast(Value);
+		TSharedPtr<const FJsonValueRecordArray::FSlots> Slots = Records ? Records->PinSlots() : nullptr;
+		if (Slots.IsValid()) {
+			PushRecords(*Records, MoveTemp(Slots));
+		}
+		else {
+			PushArray(Value.AsArray());
+		}
+		break;
+	}
+	case EJson::Object:
+	{
+		const TSharedPtr<FJsonObject>& Object = Value.AsObject();
+		if (Object.IsValid() && Stack.Num() >= MaxDepth) {
+			bTruncated = true;
+			Out.AppendChars(TEXT("null"), 4);
+		}
+		else if (Object.IsValid()) {
+			PushObject(*Object);
+		}
+		else {
+			Out.AppendChars(TEXT("null"), 4);
+		}
+		break;
+	}
+	default:
+		Out.AppendChars(TEXT("null"), 4);
+		break;
+	}
+}
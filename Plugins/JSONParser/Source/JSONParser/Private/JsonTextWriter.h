@@ -0,0 +1,112 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "JsonRecordArray.h"
+
+/**
+ * Writes a JSON object tree to a string.
+ * Replaces TJsonWriter for the plugin output: numbers use the shortest round-trip form and can be limited
+ * to a number of decimals, the pretty layout keeps arrays of numbers and booleans on one line.
+ * Containers are walked with a heap stack rather than recursion, so the depth does not depend on the thread stack.
+ */
+class FJsonTextWriter
+{
+public:
+	/* Same limit as the reader, deeper documents could not be read back */
+	static constexpr int32 DefaultMaxDepth = 16384;
+
+	/* MaxDecimals < 0 keeps the full precision */
+	FJsonTextWriter(FString& InOut, bool bInPretty, int32 InMaxDecimals = -1, int32 InMaxDepth = DefaultMaxDepth);
+
+	/* Returns false if containers nested deeper than MaxDepth were written as null */
+	bool WriteObject(const FJsonObject& Object);
+
+	/* Append a quoted and escaped string */
+	static void AppendString(FString& Out, FStringView Value);
+
+	/* Append a number with the given precision */
+	static void AppendNumber(FString& Out, double Value, int32 MaxDecimals);
+
+private:
+	using FField = TPair<FString, TSharedPtr<FJsonValue>>;
+
+	/* A container being written */
+	struct FFrame
+	{
+		enum class EKind : uint8
+		{
+			Object,
+			Array,
+			Records,
+		};
+
+		EKind Kind;
+
+		/* Nothing written yet, in the container or in the current record */
+		bool bFirst = true;
+
+		/* Pretty array of short values, kept on one line */
+		bool bInline = false;
+
+		/* Next field in Fields, next value or next record */
+		int32 Index = 0;
+
+		/* Range of the object fields in Fields */
+		int32 Begin = 0;
+		int32 End = 0;
+
+		/* Next slot of the current record, INDEX_NONE between records */
+		int32 Slot = INDEX_NONE;
+
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		const FJsonValueRecordArray* Records = nullptr;
+
+		/* Flat values of Records, pinned while they are written */
+		TSharedPtr<const FJsonValueRecordArray::FSlots> Slots;
+	};
+
+	/* Write a scalar, or open a container and push its frame */
+	void WriteValue(const FJsonValue& Value);
+	void WriteFieldStart(const FString& Key, const FJsonValue& Value, bool bFirst);
+	void WriteNewLine();
+
+	void PushObject(const FJsonObject& Object);
+	void PushArray(const TArray<TSharedPtr<FJsonValue>>& Values);
+	void PushRecords(const FJsonValueRecordArray& Records, TSharedPtr<const FJsonValueRecordArray::FSlots>&& Slots);
+
+	/* Write the next value of the top frame, or close it once it is done */
+	void Step();
+
+	/* Numbers, booleans and null are written inline in pretty arrays */
+	static bool IsShortValue(const FJsonValue& Value);
+
+	FString& Out;
+	const bool bPretty;
+	const int32 MaxDecimals;
+	const int32 MaxDepth;
+	int32 Indent;
+	bool bTruncated;
+
+	TArray<FFrame> Stack;
+
+	/* Valid fields of the open objects, each frame owns the range it was pushed with */
+	TArray<const FField*> Fields;
+};
@@ -0,0 +1,269 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonTexture.h"
+#include "JsonBase64.h"
+#include "JsonGlobals.h"
+#include "JsonParserStats.h"
+
+#include "Async/Async.h"
+#include "Hash/CityHash.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+	struct FTextureCache
+	{
+		TMap<uint64, TWeakObjectPtr<UTexture2D>> Textures;
+
+		/* Callbacks waiting for a decode in flight */
+		TMap<uint64, TArray<TFunction<void(UTexture2D*)>>> Pending;
+
+		/* Size at which the entries of collected textures are dropped */
+		int32 NextPrune = 64;
+
+		void Add(uint64 Hash, UTexture2D* Texture)
+		{
+			if (Textures.Num() >= NextPrune) {
+				for (auto It = Textures.CreateIterator(); It; ++It) {
+					if (!It.Value().IsValid()) {
+						It.RemoveCurrent();
+					}
+				}
+				NextPrune = FMath::Max(64, Textures.Num() * 2);
+			}
+			Textures.Add(Hash, Texture);
+		}
+	};
+
+	/* Game thread only */
+	FTextureCache& GetCache()
+	{
+		static FTextureCache Cache;
+		return Cache;
+	}
+
+	/* Loaded on the game thread by the first decode or encode, before any worker uses it */
+	IImageWrapperModule& GetImageWrapperModule()
+	{
+		static IImageWrapperModule& Module = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+		return Module;
+	}
+
+	void CompleteDecode(uint64 Hash, UTexture2D* Texture)
+	{
+		FTextureCache& Cache = GetCache();
+		if (Texture) {
+			Cache.Add(Hash, Texture);
+		}
+
+		TArray<TFunction<void(UTexture2D*)>> Callbacks;
+		Cache.Pending.RemoveAndCopyValue(Hash, Callbacks);
+		for (TFunction<void(UTexture2D*)>& Callback : Callbacks) {
+			Callback(Texture);
+		}
+	}
+}
+
+FStringView JsonTexture::GetPayload(const FString& Source)
+{
+	int32 Comma;
+	if (Source.FindChar(TEXT(','), Comma)) {
+		return FStringView(*Source + Comma + 1, Source.Len() - Comma - 1);
+	}
+	return FStringView(Source);
+}
+
+uint64 JsonTexture::HashPayload(FStringView Payload)
+{
+	return CityHash64(reinterpret_cast<const char*>(Payload.GetData()), Payload.Len() * sizeof(TCHAR));
+}
+
+bool JsonTexture::DecodeImage(FStringView Payload, FImage& OutImage)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	TArray<uint8> Compressed;
+	if (Payload.IsEmpty() || !JsonBase64::Decode(Payload, Compressed)) {
+		return false;
+	}
+
+	IImageWrapperModule& Module = GetImageWrapperModule();
+	const EImageFormat Format = Module.DetectImageFormat(Compressed.GetData(), Compressed.Num());
+	if (Format == EImageFormat::Invalid) {
+		return false;
+	}
+
+	TSharedPtr<IImageWrapper> Wrapper = Module.CreateImageWrapper(Format);
+	if (!Wrapper.IsValid() || !Wrapper->SetCompressed(Compressed.GetData(), Compressed.Num())) {
+		return false;
+	}
+
+	if (!Wrapper->GetRaw(ERGBFormat::BGRA, 8, OutImage.Pixels)) {
+		return false;
+	}
+
+	OutImage.Width = int32(Wrapper->GetWidth());
+	OutImage.Height = int32(Wrapper->GetHeight());
+	return OutImage.Width > 0 && OutImage.Height > 0;
+}
+
+bool JsonTexture::EncodeImage(const FImage& Image, FString& OutDataUrl)
+{
+	LLM_SCOPE_BYTAG(JSONParser);
+	TSharedPtr<IImageWrapper> Wrapper = GetImageWrapperModule().CreateImageWrapper(EImageFormat::PNG);
+	if (!Wrapper.IsValid() || !Wrapper->SetRaw(Image.Pixels.GetData(), Image.Pixels.Num(), Image.Width, Image.Height, ERGBFormat::BGRA, 8)) {
+		return false;
+	}
+
+	const TArray64<uint8> Png = Wrapper->GetCompressed();
+	if (Png.Num() == 0 || Png.Num() > MAX_int32 / 2) {
+		return false;
+	}
+
+	OutDataUrl = TEXT("data:image/png;base64,");
+	JsonBase64::Encode(Png.GetData(), int32(Png.Num()), OutDataUrl);
+	return true;
+}
+
+UTexture2D* JsonTexture::CreateTexture(const FImage& Image)
+{
+	check(IsInGameThread());
+	LLM_SCOPE_BYTAG(JSONParser);
+	UTexture2D* Texture = UTexture2D::CreateTransient(Image.Width, Image.Height, PF_B8G8R8A8);
+	if (!Texture) {
+		return nullptr;
+	}
+
+	FTexture2DMipMap& Mip = Texture->GetPlatformData()->Mips[0];
+	void* Pixels = Mip.BulkData.Lock(LOCK_READ_WRITE);
+	FMemory::Memcpy(Pixels, Image.Pixels.GetData(), FMath::Min<int64>(Image.Pixels.Num(), Mip.BulkData.GetBulkDataSize()));
+	Mip.BulkData.Unlock();
+
+	Texture->Filter = TextureFilter::TF_Nearest;
+	Texture->UpdateResource();
+	return Texture;
+}
+
+bool JsonTexture::ReadTexture(UTexture2D* Texture, FImage& OutImage)
+{
+	check(IsInGameThread());
+	const FTexturePlatformData* PlatformData = Texture ? Texture->GetPlatformData() : nullptr;
+	if (!PlatformData || PlatformData->PixelFormat != PF_B8G8R8A8 || PlatformData->Mips.Num() == 0) {
+		return false;
+	}
+
+	const FTexture2DMipMap& Mip = PlatformData->Mips[0];
+	const int64 Size = int64(Mip.SizeX) * Mip.SizeY * 4;
+	if (Size == 0 || Mip.BulkData.GetBulkDataSize() < Size) {
+		return false;
+	}
+
+	OutImage.Width = Mip.SizeX;
+	OutImage.Height = Mip.SizeY;
+	OutImage.Pixels.SetNumUninitialized(Size);
+	FMemory::Memcpy(OutImage.Pixels.GetData(), Mip.BulkData.LockReadOnly(), Size);
+	Mip.BulkData.Unlock();
+	return true;
+}
+
+UTexture2D* JsonTexture::FindCached(uint64 Hash)
+{
+	const TWeakObjectPtr<UTexture2D>* Texture = GetCache().Textures.Find(Hash);
+	return Texture ? Texture->Get() : nullptr;
+}
+
+UTexture2D* JsonTexture::Decode(const FString& Source)
+{
+	const FStringView Payload = GetPayload(Source);
+	const uint64 Hash = HashPayload(Payload);
+	if (UTexture2D* Cached = FindCached(Hash)) {
+		return Cached;
+	}
+
+	JSON_SCOPE_CYCLE_COUNTER(STAT_JsonTextureDecode);
+	FImage Image;
+	if (!DecodeImage(Payload, Image)) {
+		return nullptr;
+	}
+
+	UTexture2D* Texture = CreateTexture(Image);
+	if (Texture) {
+		GetCache().Add(Hash, Texture);
+	}
+	return Texture;
+}
+
+void JsonTexture::DecodeAsync(const FString& Source, TFunction<void(UTexture2D*)>&& OnDecoded)
+{
+	check(IsInGameThread());
+	const uint64 Hash = HashPayload(GetPayload(Source));
+	if (UTexture2D* Cached = FindCached(Hash)) {
+		OnDecoded(Cached);
+		return;
+	}
+
+	FTextureCache& Cache = GetCache();
+	if (TArray<TFunction<void(UTexture2D*)>>* Waiting = Cache.Pending.Find(Hash)) {
+		Waiting->Add(MoveTemp(OnDecoded));
+		return;
+	}
+	Cache.Pending.Add(Hash).Add(MoveTemp(OnDecoded));
+
+	GetImageWrapperModule();
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Hash, Source]()
+	{
+		TSharedRef<FImage> Image = MakeShared<FImage>();
+		bool bDecoded;
+		{
+			JSON_SCOPE_CYCLE_COUNTER(STAT_JsonTextureDecode);
+			bDecoded = DecodeImage(GetPayload(Source), *Image);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [Hash, Image, bDecoded]()
+		{
+			CompleteDecode(Hash, bDecoded ? CreateTexture(*Image) : nullptr);
+		});
+	});
+}
+
+void JsonTexture::EncodeAsync(UTexture2D* Texture, TFunction<void(bool, const FString&)>&& OnEncoded)
+{
+	check(IsInGameThread());
+	TSharedRef<FImage> Image = MakeShared<FImage>();
+	if (!ReadTexture(Texture, *Image)) {
+		UE_LOG(LogJson, Warning, TEXT("Texture '%s' has no uncompressed BGRA pixels to encode"), *GetNameSafe(Texture));
+		OnEncoded(false, FString());
+		return;
+	}
+
+	GetImageWrapperModule();
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Image, OnEncoded = MoveTemp(OnEncoded)]() mutable
+	{
+		TSharedRef<FString> DataUrl = MakeShared<FString>();
+		bool bEncoded;
+		{
+			JSON_SCOPE_CYCLE_COUNTER(STAT_JsonTextureEncode);
+			bEncoded = EncodeImage(*Image, *DataUrl);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [DataUrl, bEncoded, OnEncoded = MoveTemp(OnEncoded)]()
+		{
+			OnEncoded(bEncoded, *DataUrl);
+		});
+	});
+}
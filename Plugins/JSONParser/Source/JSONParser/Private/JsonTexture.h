@@ -0,0 +1,70 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Texture2D.h"
+
+/**
+ * Decoding of the base64 images held in string fields, shared by GetTexture and the async texture actions.
+ * Decoded textures are cached by a hash of their base64 payload, so an avatar or an icon repeated across documents
+ * decodes once for as long as a texture made from it is alive. The cache holds weak pointers and never keeps a
+ * texture from being garbage collected.
+ */
+namespace JsonTexture
+{
+	/* Pixels of a decoded image, BGRA 8 bits */
+	struct FImage
+	{
+		TArray64<uint8> Pixels;
+		int32 Width = 0;
+		int32 Height = 0;
+	};
+
+	/* Base64 payload of a data URL ("data:image/png;base64,..."), the whole string when it has no header */
+	FStringView GetPayload(const FString& Source);
+
+	/* Key of a payload in the texture cache */
+	uint64 HashPayload(FStringView Payload);
+
+	/* Decode the base64 payload and its image, any thread */
+	bool DecodeImage(FStringView Payload, FImage& OutImage);
+
+	/* Compress to PNG and encode as a data URL, any thread */
+	bool EncodeImage(const FImage& Image, FString& OutDataUrl);
+
+	/* Transient texture holding the pixels, game thread */
+	UTexture2D* CreateTexture(const FImage& Image);
+
+	/* Copy the pixels of an uncompressed BGRA texture, such as the ones CreateTexture makes, game thread */
+	bool ReadTexture(UTexture2D* Texture, FImage& OutImage);
+
+	/* Cached texture for a payload hash, null if none is alive, game thread */
+	UTexture2D* FindCached(uint64 Hash);
+
+	/* Decode on the game thread, through the cache */
+	UTexture2D* Decode(const FString& Source);
+
+	/**
+	 * Decode on a worker thread, through the cache, OnDecoded runs on the game thread with null if the decode failed.
+	 * Requests for a payload already being decoded wait for that decode instead of starting another one.
+	 */
+	void DecodeAsync(const FString& Source, TFunction<void(UTexture2D*)>&& OnDecoded);
+
+	/* Read the texture on the game thread and encode it as a PNG data URL on a worker, OnEncoded runs on the game thread */
+	void EncodeAsync(UTexture2D* Texture, TFunction<void(bool, const FString&)>&& OnEncoded);
+}
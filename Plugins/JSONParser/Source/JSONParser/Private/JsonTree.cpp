@@ -0,0 +1,96 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonTree.h"
+#include "JsonValueType.h"
+
+namespace JsonTree
+{
+	namespace
+	{
+		struct FPending
+		{
+			TArray<TSharedPtr<FJsonValue>> Values;
+			TArray<TSharedPtr<FJsonObject>> Objects;
+
+			void TakeChildren(FJsonObject& Object)
+			{
+				for (auto& Pair : Object.Values) {
+					if (Pair.Value.IsValid()) {
+						Values.Add(MoveTemp(Pair.Value));
+					}
+				}
+				Object.Values.Empty();
+			}
+
+			void Run()
+			{
+				while (Values.Num() || Objects.Num()) {
+					if (Objects.Num()) {
+						TSharedPtr<FJsonObject> Object = Objects.Pop(false);
+						if (Object.IsUnique()) {
+							TakeChildren(*Object);
+						}
+						continue;
+					}
+
+					TSharedPtr<FJsonValue> Value = Values.Pop(false);
+					if (!Value.IsUnique()) {
+						continue;
+					}
+
+					// Only the engine containers are opened, other arrays such as record arrays are released as they are
+					if (JsonValueType::IsObject(*Value)) {
+						TSharedPtr<FJsonObject>& Object = JsonValueType::GetMutableObject(*Value);
+						if (Object.IsValid()) {
+							Objects.Add(MoveTemp(Object));
+						}
+					}
+					else if (JsonValueType::IsArray(*Value)) {
+						TArray<TSharedPtr<FJsonValue>>& Array = JsonValueType::GetMutableArray(*Value);
+						for (TSharedPtr<FJsonValue>& Item : Array) {
+							if (Item.IsValid()) {
+								Values.Add(MoveTemp(Item));
+							}
+						}
+						Array.Empty();
+					}
+				}
+			}
+		};
+	}
+
+	void Release(TSharedPtr<FJsonObject>&& Object)
+	{
+		FPending Pending;
+		Pending.Objects.Add(MoveTemp(Object));
+		Pending.Run();
+	}
+
+	void Release(TSharedPtr<FJsonValue>&& Value)
+	{
+		FPending Pending;
+		Pending.Values.Add(MoveTemp(Value));
+		Pending.Run();
+	}
+
+	void Release(TArray<TSharedPtr<FJsonValue>>&& Values)
+	{
+		FPending Pending;
+		Pending.Values = MoveTemp(Values);
+		Pending.Run();
+	}
+}
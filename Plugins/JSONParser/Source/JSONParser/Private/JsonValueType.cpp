@@ -0,0 +1,115 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonValueType.h"
+#include "JsonBytes.h"
+#include "JsonRecordArray.h"
+
+namespace JsonValueType
+{
+	namespace
+	{
+		/* Protected members read through derived classes */
+		struct FTypeAccessor : public FJsonValue
+		{
+			static FString Get(const FJsonValue& Value)
+			{
+				return (Value.*(&FTypeAccessor::GetType))();
+			}
+		};
+
+		struct FStringAccessor : public FJsonValueString
+		{
+			static const FString& Get(const FJsonValueString& Value)
+			{
+				return Value.*(&FStringAccessor::Value);
+			}
+		};
+
+		struct FNumberStringAccessor : public FJsonValueNumberString
+		{
+			static const FString& Get(const FJsonValueNumberString& Value)
+			{
+				return Value.*(&FNumberStringAccessor::Value);
+			}
+		};
+
+		struct FArrayAccessor : public FJsonValueArray
+		{
+			static TArray<TSharedPtr<FJsonValue>>& Get(FJsonValueArray& Array)
+			{
+				return Array.*(&FArrayAccessor::Value);
+			}
+		};
+
+		struct FObjectAccessor : public FJsonValueObject
+		{
+			static TSharedPtr<FJsonObject>& Get(FJsonValueObject& Object)
+			{
+				return Object.*(&FObjectAccessor::Value);
+			}
+		};
+	}
+
+	bool IsString(const FJsonValue& Value)
+	{
+		return Value.Type == EJson::String && !FJsonValueBytes::Cast(Value);
+	}
+
+	bool IsArray(const FJsonValue& Value)
+	{
+		return Value.Type == EJson::Array && !FJsonValueRecordArray::Cast(Value);
+	}
+
+	bool IsObject(const FJsonValue& Value)
+	{
+		return Value.Type == EJson::Object;
+	}
+
+	bool IsNumberString(const FJsonValue& Value)
+	{
+		return Value.Type == EJson::Number && GetName(Value) == TEXT("NumberString");
+	}
+
+	FString GetName(const FJsonValue& Value)
+	{
+		return FTypeAccessor::Get(Value);
+	}
+
+	const FString& GetString(const FJsonValue& Value)
+	{
+		checkSlow(GetName(Value) == TEXT("String"));
+		return FStringAccessor::Get(static_cast<const FJsonValueString&>(Value));
+	}
+
+	const FString& GetNumberString(const FJsonValue& Value)
+	{
+		checkSlow(IsNumberString(Value));
+		return FNumberStringAccessor::Get(static_cast<const FJsonValueNumberString&>(Value));
+	}
+
+	TArray<TSharedPtr<FJsonValue>>& GetMutableArray(FJsonValue& Value)
+	{
+		checkSlow(GetName(Value) == TEXT("Array"));
+		return FArrayAccessor::Get(static_cast<FJsonValueArray&>(Value));
+	}
+
+	TSharedPtr<FJsonObject>& GetMutableObject(FJsonValue& Value)
+	{
+		checkSlow(GetName(Value) == TEXT("Object"));
+		return FObjectAccessor::Get(static_cast<FJsonValueObject&>(Value));
+	}
+}
@@ -0,0 +1,50 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * Tells the classes of JSON values apart without RTTI.
+ * FJsonValue only names its class through the protected GetType, which builds a new string on every call. A value is
+ * taken to be the engine class of its Type unless it is one of the plugin's classes of the same Type, which are ruled
+ * out without building the name while none of them is alive. The downcasts check the name in debug builds.
+ */
+namespace JsonValueType
+{
+	/* The engine class of the Type: not a binary value or a record array */
+	bool IsString(const FJsonValue& Value);
+	bool IsArray(const FJsonValue& Value);
+	bool IsObject(const FJsonValue& Value);
+
+	/* Integer literal kept as FJsonValueNumberString, builds the type name so it is meant for numbers past 2^53 only */
+	bool IsNumberString(const FJsonValue& Value);
+
+	/* Class name returned by GetType, allocates */
+	FString GetName(const FJsonValue& Value);
+
+	/* String held by a value for which IsString is true, read in place */
+	const FString& GetString(const FJsonValue& Value);
+
+	/* Literal held by a value for which IsNumberString is true, read in place */
+	const FString& GetNumberString(const FJsonValue& Value);
+
+	/* Containers of values for which IsArray and IsObject are true, for code filling or emptying them in place */
+	TArray<TSharedPtr<FJsonValue>>& GetMutableArray(FJsonValue& Value);
+	TSharedPtr<FJsonObject>& GetMutableObject(FJsonValue& Value);
+}
@@ -0,0 +1,126 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Crc.h"
+#include "JsonCodec.h"
+
+/**
+ * Key of a JSON field with its map hash computed up front.
+ * FJsonObject keeps its fields in a TMap keyed by FString, Hash is the hash that map uses, so lookups go through
+ * FindByHash with the view as the comparable key: no FString is built and nothing is rehashed per access.
+ * The key only views its characters, the string it was made from has to outlive it.
+ */
+class FJsonKey
+{
+public:
+	FJsonKey(FStringView InName)
+		: Name(InName)
+		, Hash(FCrc::Strihash_DEPRECATED(InName.Len(), InName.GetData()))
+	{
+	}
+
+	FJsonKey(const TCHAR* InName)
+		: FJsonKey(FStringView(InName))
+	{
+	}
+
+	FJsonKey(const FString& InName)
+		: FJsonKey(FStringView(InName))
+	{
+	}
+
+	FStringView Name;
+	uint32 Hash;
+};
+
+/* Key for a literal, hashed once per call site the first time it runs: JSON_KEY("price") */
+#define JSON_KEY(Literal) ([]() -> const FJsonKey& { static const FJsonKey Key(TEXT(Literal)); return Key; }())
+
+/**
+ * Typed access to the fields of a FJsonObject, for C++ code reading JSON every frame.
+ * Values are converted with the JsonCodec overloads, so any type a JSON_CODEC field can hold is supported.
+ *
+ *	const float Price = JsonAccess::Get<float>(*Item, JSON_KEY("price"));
+ *	JsonAccess::Set(*Item, JSON_KEY("count"), Count + 1);
+ */
+namespace JsonAccess
+{
+	/* Value of a field, nullptr if it is missing */
+	inline const FJsonValue* Find(const FJsonObject& Object, const FJsonKey& Key)
+	{
+		const TSharedPtr<FJsonValue>* Value = Object.Values.FindByHash(Key.Hash, Key.Name);
+		return Value ? Value->Get() : nullptr;
+	}
+
+	/* Nested object of a field, nullptr if it is missing or not an object */
+	inline const FJsonObject* FindObject(const FJsonObject& Object, const FJsonKey& Key)
+	{
+		const FJsonValue* Value = Find(Object, Key);
+		const TSharedPtr<FJsonObject>* Nested;
+		return Value && Value->TryGetObject(Nested) ? Nested->Get() : nullptr;
+	}
+
+	/* Elements of an array field, nullptr if it is missing or not an array */
+	inline const TArray<TSharedPtr<FJsonValue>>* FindArray(const FJsonObject& Object, const FJsonKey& Key)
+	{
+		const FJsonValue* Value = Find(Object, Key);
+		const TArray<TSharedPtr<FJsonValue>>* Elements;
+		return Value && Value->TryGetArray(Elements) ? Elements : nullptr;
+	}
+
+	inline bool Has(const FJsonObject& Object, const FJsonKey& Key)
+	{
+		return Find(Object, Key) != nullptr;
+	}
+
+	/* Read a field, false if it is missing or holds another type */
+	template<typename T>
+	bool TryGet(const FJsonObject& Object, const FJsonKey& Key, T& OutValue)
+	{
+		const FJsonValue* Value = Find(Object, Key);
+		return Value && JsonCodec::FromJson(*Value, OutValue);
+	}
+
+	/* Read a field, Default if it is missing or holds another type */
+	template<typename T>
+	T Get(const FJsonObject& Object, const FJsonKey& Key, const T& Default = T())
+	{
+		T Value = Default;
+		TryGet(Object, Key, Value);
+		return Value;
+	}
+
+	/* Write a field, the key is only copied when the field does not exist yet */
+	template<typename T>
+	void Set(FJsonObject& Object, const FJsonKey& Key, const T& Value)
+	{
+		TSharedPtr<FJsonValue> Json = JsonCodec::ToJson(Value);
+		if (TSharedPtr<FJsonValue>* Existing = Object.Values.FindByHash(Key.Hash, Key.Name)) {
+			*Existing = MoveTemp(Json);
+		}
+		else {
+			Object.Values.AddByHash(Key.Hash, FString(Key.Name), MoveTemp(Json));
+		}
+	}
+
+	inline bool Remove(FJsonObject& Object, const FJsonKey& Key)
+	{
+		return Object.Values.RemoveByHash(Key.Hash, Key.Name) > 0;
+	}
+}
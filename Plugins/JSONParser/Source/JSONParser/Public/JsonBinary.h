@@ -0,0 +1,63 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+/**
+* Compact binary encoding of a JSON document.
+*
+* Layout: the 'JSNB' magic, a version byte, then the root value. Every value starts with a tag byte,
+* lengths and counts are LEB128 varints, strings are UTF-8 and doubles are stored in the platform (little endian) order.
+* Integral numbers are zigzag varints, which keeps 64-bit ids exact and small counters on a single byte.
+* Object keys are written once per document and referenced by index afterwards, which keeps arrays of records small.
+* Both directions walk the tree with a heap stack, the nesting depth does not depend on the thread stack.
+*/
+class JSONPARSER_API FJsonBinary
+{
+public:
+
+	enum class ETag : uint8
+	{
+		Null = 0,
+		False = 1,
+		True = 2,
+		Number = 3,
+		String = 4,
+		Array = 5,
+		Object = 6,
+		Integer = 7,
+		Bytes = 8,
+	};
+
+	/* Version 2 added the Integer tag, version 3 the Bytes tag, older documents are still read */
+	static constexpr uint8 Version = 3;
+
+	/* Containers deeper than this are written as null and rejected when read, same limit as the text reader */
+	static constexpr int32 DefaultMaxDepth = 16384;
+
+	/* Appends the encoded document to Out */
+	static void Write(const TSharedPtr<FJsonObject>& Object, TArray<uint8>& Out, int32 MaxDepth = DefaultMaxDepth);
+
+	/* Decodes a document, returns false if the buffer is not a valid binary document */
+	static bool Read(TArrayView<const uint8> Buffer, TSharedPtr<FJsonObject>& OutObject, int32 MaxDepth = DefaultMaxDepth);
+
+	/* Checks the magic and the version of the buffer */
+	static bool IsBinary(TArrayView<const uint8> Buffer);
+};
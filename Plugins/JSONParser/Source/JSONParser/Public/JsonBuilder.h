@@ -0,0 +1,135 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Writes JSON text straight from a chain of calls, without building a FJsonObject first.
+ * Strings and numbers go through the same escaping and shortest round-trip formatting as the plugin writer.
+ *
+ *	FString Text;
+ *	FJsonBuilder(Text)
+ *		.BeginObject()
+ *			.Field(TEXT("id"), Id)
+ *			.BeginArray(TEXT("tags")).Value(TEXT("a")).Value(TEXT("b")).EndArray()
+ *		.EndObject();
+ *
+ * Given an archive, the text is streamed as UTF-8 instead: a file writer from IFileManager::CreateFileWriter,
+ * a FMemoryWriter over the bytes of an HTTP body, or any other archive. Only about FlushSize characters are kept
+ * in memory, whatever the size of the document.
+ */
+class JSONPARSER_API FJsonBuilder
+{
+public:
+	static constexpr int32 DefaultFlushSize = 64 * 1024;
+
+	/* Appends to Out, MaxDecimals < 0 keeps the full precision of numbers */
+	explicit FJsonBuilder(FString& InOut, int32 InMaxDecimals = -1);
+
+	/* Writes to the archive each time FlushSize characters are buffered */
+	explicit FJsonBuilder(FArchive& InArchive, int32 InMaxDecimals = -1, int32 InFlushSize = DefaultFlushSize);
+
+	/* Hands the text still buffered to the archive */
+	~FJsonBuilder();
+
+	FJsonBuilder(const FJsonBuilder&) = delete;
+	FJsonBuilder& operator=(const FJsonBuilder&) = delete;
+
+	FJsonBuilder& BeginObject();
+	FJsonBuilder& BeginObject(FStringView InKey);
+	FJsonBuilder& EndObject();
+
+	FJsonBuilder& BeginArray();
+	FJsonBuilder& BeginArray(FStringView InKey);
+	FJsonBuilder& EndArray();
+
+	/* Name of the next value, only inside an object */
+	FJsonBuilder& Key(FStringView InKey);
+
+	FJsonBuilder& Value(bool InValue);
+	FJsonBuilder& Value(int32 InValue);
+	FJsonBuilder& Value(uint32 InValue);
+	FJsonBuilder& Value(int64 InValue);
+	FJsonBuilder& Value(double InValue);
+	FJsonBuilder& Value(const TCHAR* InValue);
+	FJsonBuilder& Value(FStringView InValue);
+	FJsonBuilder& Value(const FName& InValue);
+	FJsonBuilder& Value(const FJsonObject& InValue);
+	FJsonBuilder& Null();
+
+	template<typename T>
+	FJsonBuilder& Field(FStringView InKey, const T& InValue)
+	{
+		return Key(InKey).Value(InValue);
+	}
+
+	FJsonBuilder& NullField(FStringView InKey)
+	{
+		return Key(InKey).Null();
+	}
+
+	/* True once the root value has been closed */
+	bool IsComplete() const
+	{
+		return Scopes.Num() == 0 && !bFirst;
+	}
+
+	/* True inside an object, where every value needs a key */
+	bool IsInObject() const
+	{
+		return Scopes.Num() > 0 && Scopes.Last();
+	}
+
+	/* Number of open objects and arrays */
+	int32 GetDepth() const
+	{
+		return Scopes.Num();
+	}
+
+	/* Hands the buffered text to the archive and flushes it, false if the archive failed. Does nothing for strings */
+	bool Flush();
+
+	/* UTF-8 bytes handed to the archive so far */
+	int64 GetBytesWritten() const
+	{
+		return BytesWritten;
+	}
+
+private:
+	/* Writes the comma before a value when needed */
+	void BeginValue();
+
+	/* Converts the buffered text and serializes it into the archive */
+	void WriteBuffered();
+
+	FString& Out;
+	const int32 MaxDecimals;
+
+	/* Archive mode: Out is Buffer, written to Archive in chunks of FlushSize characters */
+	FArchive* Archive = nullptr;
+	FString Buffer;
+	const int32 FlushSize = 0;
+	int64 BytesWritten = 0;
+
+	/* No value written yet in the current scope */
+	bool bFirst = true;
+
+	/* Open scopes, true for objects */
+	TArray<bool, TInlineAllocator<16>> Scopes;
+};
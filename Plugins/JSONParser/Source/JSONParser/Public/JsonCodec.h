@@ -0,0 +1,291 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "UObject/Class.h"
+
+/**
+ * Reflection-free serializer of a C++ struct, filled in by the JSON_CODEC macro.
+ *
+ * The macro takes a list macro naming the fields and emits straight-line code: one SetField per field on write,
+ * and on read a switch on the hash of each key. The hashes are computed at compile time, so two fields hashing alike
+ * fail the build (duplicate case) and the dispatch is a perfect hash with a single string compare per key.
+ * Keys are matched without case, like the reflection path.
+ *
+ *	#define FMyMessage_JSON(Field) Field(Id) Field(Position) Field(Tags)
+ *	JSON_CODEC(FMyMessage, FMyMessage_JSON)
+ *
+ * Supported field types: bool, signed and 32-bit integers (int64 kept exact), float, double, FString, FName, FVector, FRotator,
+ * FLinearColor, enums, other structs with a codec, TArray and TMap<FString, ...> of these.
+ */
+template<typename T>
+struct TJsonCodec
+{
+	static constexpr bool bEnabled = false;
+};
+
+namespace JsonCodec
+{
+	/* Case-insensitive FNV-1a of a key, ASCII letters are folded to lower case */
+	constexpr uint32 HashKey(const TCHAR* Key, int32 Len)
+	{
+		uint32 Hash = 2166136261u;
+		for (int32 Index = 0; Index < Len; ++Index) {
+			const TCHAR Char = Key[Index];
+			Hash = (Hash ^ uint32(Char >= 'A' && Char <= 'Z' ? Char + ('a' - 'A') : Char)) * 16777619u;
+		}
+		return Hash;
+	}
+
+	template<SIZE_T N>
+	constexpr uint32 HashKey(const TCHAR (&Key)[N])
+	{
+		return HashKey(Key, int32(N - 1));
+	}
+
+	/* Exact integer held by a value, see JsonNumber::TryGetInteger */
+	JSONPARSER_API bool ReadInteger(const FJsonValue& Json, int64& OutValue);
+
+	/* Number value, integers past 2^53 are kept exact as their literal */
+	JSONPARSER_API TSharedPtr<FJsonValue> MakeInteger(int64 Value);
+
+	inline TSharedPtr<FJsonValue> ToJson(bool Value) { return MakeShared<FJsonValueBoolean>(Value); }
+	inline TSharedPtr<FJsonValue> ToJson(int32 Value) { return MakeShared<FJsonValueNumber>(Value); }
+	inline TSharedPtr<FJsonValue> ToJson(uint32 Value) { return MakeShared<FJsonValueNumber>(Value); }
+	inline TSharedPtr<FJsonValue> ToJson(int64 Value) { return MakeInteger(Value); }
+	inline TSharedPtr<FJsonValue> ToJson(float Value) { return MakeShared<FJsonValueNumber>(Value); }
+	inline TSharedPtr<FJsonValue> ToJson(double Value) { return MakeShared<FJsonValueNumber>(Value); }
+	inline TSharedPtr<FJsonValue> ToJson(const FString& Value) { return MakeShared<FJsonValueString>(Value); }
+	inline TSharedPtr<FJsonValue> ToJson(const FName& Value) { return MakeShared<FJsonValueString>(Value.ToString()); }
+	JSONPARSER_API TSharedPtr<FJsonValue> ToJson(const FVector& Value);
+	JSONPARSER_API TSharedPtr<FJsonValue> ToJson(const FRotator& Value);
+	JSONPARSER_API TSharedPtr<FJsonValue> ToJson(const FLinearColor& Value);
+
+	template<typename T>
+	typename TEnableIf<TIsEnum<T>::Value, TSharedPtr<FJsonValue>>::Type ToJson(T Value);
+	template<typename T>
+	typename TEnableIf<TJsonCodec<T>::bEnabled, TSharedPtr<FJsonValue>>::Type ToJson(const T& Value);
+	template<typename T>
+	TSharedPtr<FJsonValue> ToJson(const TArray<T>& Value);
+	template<typename T>
+	TSharedPtr<FJsonValue> ToJson(const TMap<FString, T>& Value);
+
+	/* Readers return false and leave the value untouched when the JSON value has another type */
+	inline bool FromJson(const FJsonValue& Json, bool& Out) { return Json.TryGetBool(Out); }
+	inline bool FromJson(const FJsonValue& Json, float& Out) { return Json.TryGetNumber(Out); }
+	inline bool FromJson(const FJsonValue& Json, double& Out) { return Json.TryGetNumber(Out); }
+	inline bool FromJson(const FJsonValue& Json, FString& Out) { return Json.TryGetString(Out); }
+	JSONPARSER_API bool FromJson(const FJsonValue& Json, FName& Out);
+	JSONPARSER_API bool FromJson(const FJsonValue& Json, FVector& Out);
+	JSONPARSER_API bool FromJson(const FJsonValue& Json, FRotator& Out);
+	JSONPARSER_API bool FromJson(const FJsonValue& Json, FLinearColor& Out);
+
+	template<typename T>
+	typename TEnableIf<TIsIntegral<T>::Value && !std::is_same_v<T, bool>, bool>::Type FromJson(const FJsonValue& Json, T& Out);
+	template<typename T>
+	typename TEnableIf<TIsEnum<T>::Value, bool>::Type FromJson(const FJsonValue& Json, T& Out);
+	template<typename T>
+	typename TEnableIf<TJsonCodec<T>::bEnabled, bool>::Type FromJson(const FJsonValue& Json, T& Out);
+	template<typename T>
+	bool FromJson(const FJsonValue& Json, TArray<T>& Out);
+	template<typename T>
+	bool FromJson(const FJsonValue& Json, TMap<FString, T>& Out);
+
+	template<typename T>
+	typename TEnableIf<TIsEnum<T>::Value, TSharedPtr<FJsonValue>>::Type ToJson(T Value)
+	{
+		return MakeShared<FJsonValueNumber>(double(int64(Value)));
+	}
+
+	template<typename T>
+	typename TEnableIf<TJsonCodec<T>::bEnabled, TSharedPtr<FJsonValue>>::Type ToJson(const T& Value)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		TJsonCodec<T>::Write(Value, *Object);
+		return MakeShared<FJsonValueObject>(Object);
+	}
+
+	template<typename T>
+	TSharedPtr<FJsonValue> ToJson(const TArray<T>& Value)
+	{
+		TArray<TSharedPtr<FJsonValue>> Elements;
+		Elements.Reserve(Value.Num());
+		for (const T& Element : Value) {
+			Elements.Add(ToJson(Element));
+		}
+		return MakeShared<FJsonValueArray>(MoveTemp(Elements));
+	}
+
+	template<typename T>
+	TSharedPtr<FJsonValue> ToJson(const TMap<FString, T>& Value)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->Values.Reserve(Value.Num());
+		for (const TPair<FString, T>& Pair : Value) {
+			Object->Values.Add(Pair.Key, ToJson(Pair.Value));
+		}
+		return MakeShared<FJsonValueObject>(Object);
+	}
+
+	template<typename T>
+	typename TEnableIf<TIsIntegral<T>::Value && !std::is_same_v<T, bool>, bool>::Type FromJson(const FJsonValue& Json, T& Out)
+	{
+		int64 Value;
+		if (!ReadInteger(Json, Value)) {
+			return false;
+		}
+		Out = T(Value);
+		return true;
+	}
+
+	template<typename T>
+	typename TEnableIf<TIsEnum<T>::Value, bool>::Type FromJson(const FJsonValue& Json, T& Out)
+	{
+		int64 Value;
+		if (!ReadInteger(Json, Value)) {
+			return false;
+		}
+		Out = T(Value);
+		return true;
+	}
+
+	template<typename T>
+	typename TEnableIf<TJsonCodec<T>::bEnabled, bool>::Type FromJson(const FJsonValue& Json, T& Out)
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if (!Json.TryGetObject(Object)) {
+			return false;
+		}
+		TJsonCodec<T>::Read(**Object, Out);
+		return true;
+	}
+
+	template<typename T>
+	bool FromJson(const FJsonValue& Json, TArray<T>& Out)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Elements;
+		if (!Json.TryGetArray(Elements)) {
+			return false;
+		}
+
+		Out.Reset(Elements->Num());
+		Out.SetNum(Elements->Num());
+		for (int32 Index = 0; Index < Elements->Num(); ++Index) {
+			if ((*Elements)[Index].IsValid()) {
+				FromJson(*(*Elements)[Index], Out[Index]);
+			}
+		}
+		return true;
+	}
+
+	template<typename T>
+	bool FromJson(const FJsonValue& Json, TMap<FString, T>& Out)
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if (!Json.TryGetObject(Object)) {
+			return false;
+		}
+
+		Out.Reset();
+		Out.Reserve((*Object)->Values.Num());
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Object)->Values) {
+			if (Pair.Value.IsValid()) {
+				FromJson(*Pair.Value, Out.Add(Pair.Key));
+			}
+		}
+		return true;
+	}
+
+	/* Type erased codec of a USTRUCT, lets the reflection path skip the property walk */
+	struct FStructCodec
+	{
+		TSharedPtr<FJsonObject> (*Write)(const void* Struct) = nullptr;
+		void (*Read)(const FJsonObject& Object, void* Struct) = nullptr;
+	};
+
+	/* Codecs registered with JSON_CODEC_REGISTER, by script struct */
+	class JSONPARSER_API FRegistry
+	{
+	public:
+		static void Register(UScriptStruct* (*GetStruct)(), const FStructCodec& Codec);
+
+		/* Codec of a struct, false if it has none */
+		static bool Find(const UScriptStruct* Struct, FStructCodec& OutCodec);
+	};
+
+	template<typename T>
+	struct TRegistrar
+	{
+		TRegistrar()
+		{
+			FStructCodec Codec;
+			Codec.Write = [](const void* Struct) -> TSharedPtr<FJsonObject>
+			{
+				TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+				TJsonCodec<T>::Write(*static_cast<const T*>(Struct), *Object);
+				return Object;
+			};
+			Codec.Read = [](const FJsonObject& Object, void* Struct)
+			{
+				TJsonCodec<T>::Read(Object, *static_cast<T*>(Struct));
+			};
+			FRegistry::Register(&TBaseStructure<T>::Get, Codec);
+		}
+	};
+}
+
+#define JSON_CODEC_COUNT(Name) + 1
+#define JSON_CODEC_WRITE(Name) Object.Values.Add(TEXT(#Name), JsonCodec::ToJson(Value.Name));
+#define JSON_CODEC_READ(Name) \
+	case JsonCodec::HashKey(TEXT(#Name)): \
+		if (Field.Key == TEXT(#Name)) { \
+			JsonCodec::FromJson(*Field.Value, Value.Name); \
+		} \
+		break;
+
+/* Specialize TJsonCodec for Type, Fields is a list macro calling its argument with each field name */
+#define JSON_CODEC(Type, Fields) \
+	template<> \
+	struct TJsonCodec<Type> \
+	{ \
+		static constexpr bool bEnabled = true; \
+		static void Write(const Type& Value, FJsonObject& Object) \
+		{ \
+			Object.Values.Reserve(Object.Values.Num() Fields(JSON_CODEC_COUNT)); \
+			Fields(JSON_CODEC_WRITE) \
+		} \
+		static void Read(const FJsonObject& Object, Type& Value) \
+		{ \
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object.Values) { \
+				if (!Field.Value.IsValid()) { \
+					continue; \
+				} \
+				switch (JsonCodec::HashKey(*Field.Key, Field.Key.Len())) { \
+				Fields(JSON_CODEC_READ) \
+				default: \
+					break; \
+				} \
+			} \
+		} \
+	};
+
+/* Use the codec of a USTRUCT from the reflection path (Add Any Field, UObject fields), goes in a .cpp file */
+#define JSON_CODEC_REGISTER(Type) \
+	static JsonCodec::TRegistrar<Type> PREPROCESSOR_JOIN(JsonCodecRegistrar, __LINE__);
@@ -0,0 +1,76 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "JsonSnapshot.h"
+
+#include "JsonDataAsset.generated.h"
+
+class UAssetImportData;
+class UJsonFieldData;
+
+/**
+ * JSON document imported from a .json file in the editor.
+ * The document is stored in the compact binary format (see JsonBinary.h) and serialized with the package, so loading
+ * the asset reads it in one block and no text is parsed at runtime. It is decoded on first access and shared by every
+ * view afterwards.
+ */
+UCLASS(BlueprintType)
+class JSONPARSER_API UJsonDataAsset : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/* Immutable document, decoded on the first call, safe to read from any thread */
+	FJsonSnapshot GetSnapshot() const;
+
+	/* Copy-on-write view of the document, writes only change the returned JSON */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get JSON", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"), Category = "JSON")
+	UJsonFieldData* GetJson(UObject* WorldContextObject) const;
+
+	/* Size of the binary document in bytes */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Binary Size"), Category = "JSON")
+	int32 GetBinarySize() const;
+
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void BeginDestroy() override;
+
+#if WITH_EDITOR
+	/* Replace the document with the content of a JSON text, returns false if the text is not a JSON object */
+	bool ImportText(const FString& Text);
+
+	virtual void PostInitProperties() override;
+	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
+#endif
+
+#if WITH_EDITORONLY_DATA
+	/* Source file and import time, used by reimport */
+	UPROPERTY(VisibleAnywhere, Instanced, Category = ImportSettings)
+	TObjectPtr<UAssetImportData> AssetImportData;
+#endif
+
+private:
+
+	/* Document in the FJsonBinary format */
+	TArray<uint8> Binary;
+
+	mutable FCriticalSection DecodeLock;
+	mutable TSharedPtr<FJsonObject> Root;
+};
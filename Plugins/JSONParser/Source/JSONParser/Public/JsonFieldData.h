@@ -24,12 +24,105 @@ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 
 #include "Serialization/JsonSerializer.h"
 
+#include "JsonAccess.h"
+#include "JsonSnapshot.h"
+
 #include "Engine/World.h"
 #include "UObject/UnrealType.h"
 
 #include "JsonFieldData.generated.h"
 
 class FProperty;
+class FJsonProjection;
+class FJsonValueRecordArray;
+struct FJsonCowState;
+
+/* Memory held by a JSON document, broken down by node type */
+USTRUCT(BlueprintType)
+struct FJsonMemoryFootprint
+{
+	GENERATED_BODY()
+
+	/* Object nodes and their field maps */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	int64 ObjectBytes = 0;
+
+	/* Array nodes and their element storage */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	int64 ArrayBytes = 0;
+
+	/* String nodes, including their characters */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	int64 StringBytes = 0;
+
+	/* Number nodes */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	int64 NumberBytes = 0;
+
+	/* Boolean and null nodes */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	int64 OtherBytes = 0;
+
+	/* Field names */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	int64 KeyBytes = 0;
+
+	/* Sum of all of the above */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	int64 TotalBytes = 0;
+
+	/* Number of objects, arrays and values */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	int32 NodeCount = 0;
+
+	/* Number of field names */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	int32 KeyCount = 0;
+};
+
+/* Value type of a column read from an array of objects */
+UENUM(BlueprintType)
+enum class EJsonColumnType : uint8
+{
+	Number,
+	String,
+	Bool,
+	Vector
+};
+
+/* One field read from every object of an array, only the array matching Type is filled */
+USTRUCT(BlueprintType)
+struct FJsonColumn
+{
+	GENERATED_BODY()
+
+	/* Field to read in every object */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JSON")
+	FString Field;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JSON")
+	EJsonColumnType Type = EJsonColumnType::Number;
+
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	TArray<float> Numbers;
+
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	TArray<FString> Strings;
+
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	TArray<bool> Bools;
+
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	TArray<FVector> Vectors;
+
+	FJsonColumn() = default;
+
+	FJsonColumn(const FString& InField, EJsonColumnType InType)
+		: Field(InField)
+		, Type(InType)
+	{
+	}
+};
 
 UCLASS(BlueprintType, Blueprintable)
 class UJsonFieldData : public UObject
@@ -41,18 +134,72 @@ private:
 	/* Resets the current post data */
 	void Reset();
 
-	void WriteObject(TSharedRef<TJsonWriter<TCHAR>> writer, FString key, FJsonValue* value);
+	/* Clone the objects on the path to this view which may be shared in copy-on-write mode, false if frozen */
+	bool PrepareWrite();
+
+	/* Make this view a child of Parent in its document, Index is the element for array views */
+	void LinkCopyOnWrite(const UJsonFieldData* Parent, const FString& Key, int32 Index);
+
+	/* The object Data was read from in the parent view, null if it is gone */
+	TSharedPtr<FJsonObject> FindCowChild(const FString& Key, int32 Index) const;
+
+	/* Data was replaced by a new tree, which no other JSON shares */
+	void OnDataReplaced();
+
+	/* Replace Data with the parsed string, see FromString */
+	UJsonFieldData* ReadString(const FString& dataString, const FJsonProjection* Projection);
+
+	/* Object of Source to store in this JSON, see SetObject */
+	TSharedPtr<FJsonObject> ShareObject(const UJsonFieldData* Source) const;
+
+	/* Data is valid, or this views a record which builds it on the first write */
+	bool HasData() const;
+
+	/* Replace a record view by the object of its record, the record array builds the objects of all its records */
+	bool ResolveData();
+
+	/* State shared by the views of a document, null until copy-on-write, snapshots or views need it */
+	TSharedPtr<FJsonCowState> Cow;
+
+	/* View this view was read from, with the key and array index of its object */
+	UPROPERTY()
+	UJsonFieldData* CowParent = nullptr;
+
+	FString CowKey;
+	int32 CowIndex = INDEX_NONE;
+
+	/* Record CowIndex of a flat record array, read in place while Data is null, see GetObjectArray */
+	TSharedPtr<const FJsonValueRecordArray> Records;
+	TSharedPtr<const TArray<TSharedPtr<FJsonValue>>> RecordSlots;
+
+	/* Value of a field from its precomputed hash, see Get */
+	const FJsonValue* FindKey(const FJsonKey& Key) const;
 public:
 	UObject* contextObject;
 
-	/* The actual field data */
+	/* The actual field data, null for the record views of Get Object Array until they are written */
 	TSharedPtr<FJsonObject> Data;
 
+	/* Value of a field, read in place for record views */
+	TSharedPtr<FJsonValue> FindField(const FString& Key) const;
+
+	/* The object this JSON views. A record view builds a new object sharing the values of its record */
+	TSharedPtr<FJsonObject> ReadObject() const;
+
+	/* Number of decimals written for numbers, negative for the shortest exact form */
+	int32 MaxDecimals = -1;
+
+	/* UObjects are written once in an object table and referenced by id, see SetObjectGraph */
+	bool bObjectGraph = false;
+
 	class UWorld* GetWorld() const override 
 	{
 		return GEngine->GetWorldFromContextObject(contextObject, EGetWorldErrorMode::LogAndReturnNull);
 	}
 
+	/* Releases the document without recursion, see JsonTree.h */
+	virtual void BeginDestroy() override;
+
 	/* Get Content of the FieldData as a String */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Content String"), Category = "JSON")
 	FString GetContentString();
@@ -65,17 +212,61 @@ public:
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Archive"), Category = "JSON")
 	void GetContentCompressed(TArray<uint8>& Compressed, bool& bIsValid);
 
+	/* Get Content of the FieldData in the compact binary format */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Binary"), Category = "JSON")
+	void GetContentBinary(TArray<uint8>& Binary);
+
+	/* Get the memory held by the document, nodes shared with other documents are counted once */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Memory Footprint"), Category = "JSON")
+	FJsonMemoryFootprint GetMemoryFootprint() const;
+
+	/* JSON value of a property, as Add Any Field writes it. Safe off the game thread for properties without object references */
+	static TSharedPtr<FJsonValue> PropertyToJsonValue(const FProperty* Property, const void* PropertyData)
+	{
+		return GetJsonValue(Property, PropertyData);
+	}
+
+	/* Walk a JSON object and report the memory it holds */
+	static FJsonMemoryFootprint ComputeMemoryFootprint(const TSharedPtr<FJsonObject>& Object);
+
+	/* Serialize a JSON object to a condensed or pretty string, MaxDecimals < 0 keeps the shortest exact form of numbers, bOutComplete is false if nested containers were dropped */
+	static FString SerializeObject(const TSharedPtr<FJsonObject>& Object, bool bPretty, int32 MaxDecimals = -1, bool* bOutComplete = nullptr);
+
+	/* Limit the number of decimals written for numbers, -1 restores the shortest exact form */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Number Precision"), Category = "JSON")
+	UJsonFieldData* SetNumberPrecision(int32 Decimals);
+
+	/* Write the UObjects reached by Add UObject Field and Add Any Field once each, shared and cyclic references included */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Object Graph Mode"), Category = "JSON")
+	UJsonFieldData* SetObjectGraph(bool bEnabled);
+
+	/* Deserialize a JSON string, returns false if the input is not a valid JSON object. Only the fields in Projection are built if set */
+	static bool DeserializeObject(const FString& Text, TSharedPtr<FJsonObject>& OutObject, const FJsonProjection* Projection = nullptr);
+
+	/* Compress a string in the archive format (uncompressed size followed by the zlib data) */
+	static bool CompressString(const FString& UncompressedData, TArray<uint8>& Compressed);
+
+	/* Uncompress a buffer in the archive format */
+	static bool UncompressString(const TArray<uint8>& Compressed, FString& UncompressedData);
+
 	/* Creates a new post data object */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create JSON Data", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"), Category = "JSON")
 	static UJsonFieldData* Create(UObject* WorldContextObject);
 
-	/* Creates a new post data object */
-	static UJsonFieldData* CreateFromJson(UObject* WorldContextObject, TSharedPtr<FJsonObject> Data);
+	/* Creates a new post data object viewing Data, with bCopyOnWrite Data is never written and is cloned lazily instead */
+	static UJsonFieldData* CreateFromJson(UObject* WorldContextObject, TSharedPtr<FJsonObject> Data, bool bCopyOnWrite = false);
+
+	/* Deep copy of a JSON object, leaf values are immutable and stay shared */
+	static TSharedPtr<FJsonObject> DeepClone(const TSharedPtr<FJsonObject>& Object);
 
 	/* Creates a new post data object */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create JSON Data From String", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"), Category = "JSON")
 	static UJsonFieldData* CreateFromString(UObject* WorldContextObject, const FString& data);
 
+	/* Creates a new post data object holding only the Fields of the string, see From String Projected */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create JSON Data From String Projected", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"), Category = "JSON")
+	static UJsonFieldData* CreateFromStringProjected(UObject* WorldContextObject, const FString& data, const TArray<FString>& Fields);
+
 	/* Adds string data to the post data */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Add String Field"), Category = "JSON")
 	UJsonFieldData* SetString(const FString& key, const FString& value);
@@ -100,6 +291,10 @@ public:
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Add Byte Array Field"), Category = "JSON")
 	UJsonFieldData* SetByteArray(const FString& key, const TArray<uint8> arrayData);
 
+	/* Adds binary data to the post data, kept as one buffer and written as base64 (unpadded base64url if bUrlSafe) */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Add Binary Field"), Category = "JSON")
+	UJsonFieldData* SetBinary(const FString& key, const TArray<uint8>& value, bool bUrlSafe = false);
+
 	/* Adds Bool data to the post data */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Add Bool Field"), Category = "JSON")
 	UJsonFieldData* SetBool(const FString& key, bool value);
@@ -116,6 +311,10 @@ public:
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Add Number Array Field"), Category = "JSON")
 	UJsonFieldData* SetNumberArray(const FString& key, const TArray<float> arrayData);
 
+	/* Adds an exact 64-bit integer to the post data */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Add Integer Field"), Category = "JSON")
+	UJsonFieldData* SetInteger(const FString& key, int64 value);
+
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Add Vector Field"), Category = "JSON")
 	UJsonFieldData * SetVector(const FString & key, FVector value);
 
@@ -171,6 +370,13 @@ public:
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Byte Array Field"), Category = "JSON")
 	TArray<uint8> GetByteArray(const FString& key) const;
 
+	/* Gets binary data from a binary field or from a base64 string */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Binary Field"), Category = "JSON")
+	TArray<uint8> GetBinary(const FString& key) const;
+
+	/* Buffer of a field added with SetBinary, without copying it, empty for any other field */
+	TConstArrayView<uint8> ViewBinary(const FString& key) const;
+
 	/* Gets Bool data from the post data */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Bool Field"), Category = "JSON")
 	bool GetBool(const FString& key) const;
@@ -187,6 +393,14 @@ public:
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Number Array Field"), Category = "JSON")
 	TArray<float> GetNumberArray(const FString& key) const;
 
+	/* Gets an exact 64-bit integer from the post data */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Integer Field"), Category = "JSON")
+	int64 GetInteger(const FString& key) const;
+
+	/* Gets an array of exact 64-bit integers with the specified key */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Integer64 Array Field"), Category = "JSON")
+	TArray<int64> GetInteger64Array(const FString& key) const;
+
 	/* Fetches nested post data from the post data */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Object Field"), Category = "JSON")
 	UJsonFieldData* GetObject(const FString& key) const;
@@ -213,14 +427,84 @@ public:
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Vector Array Field"), Category = "JSON")
 	TArray<FVector> GetVectorArray(const FString & key) const;
 
+	/* Get a Number field from every object of an array */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Number Column"), Category = "JSON")
+	TArray<float> GetColumnNumber(const FString& key, const FString& field) const;
 
-	/* Fetches nested post data from the post data */
-	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Class Field"), Category = "JSON")
-	UClass* GetClass(const FString& key) const;
+	/* Get a String field from every object of an array */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get String Column"), Category = "JSON")
+	TArray<FString> GetColumnString(const FString& key, const FString& field) const;
 
-	/* Gets an array with post data with the specified key */
-	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Class Array Field"), Category = "JSON")
-	TArray<UClass*> GetClassArray(const FString& key) const;
+	/* Get a Bool field from every object of an array */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Bool Column"), Category = "JSON")
+	TArray<bool> GetColumnBool(const FString& key, const FString& field) const;
+
+	/* Get a Vector field from every object of an array */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Vector Column"), Category = "JSON")
+	TArray<FVector> GetColumnVector(const FString& key, const FString& field) const;
+
+	/* Get several fields from every object of an array in a single pass */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Columns"), Category = "JSON")
+	TArray<FJsonColumn> GetColumns(const FString& key, const TArray<FJsonColumn>& columns) const;
+
+	/* Fill the columns from the objects of an array, false if the array is missing */
+	static bool ReadColumns(const TSharedPtr<FJsonObject>& Object, const FString& Key, TArray<FJsonColumn>& Columns);
+
+	/* Add a struct field with its JSON_CODEC, without going through reflection */
+	template<typename T>
+	UJsonFieldData* SetStruct(const FString& key, const T& value)
+	{
+		static_assert(TJsonCodec<T>::bEnabled, "SetStruct requires a JSON_CODEC for the struct");
+		if (PrepareWrite()) {
+			Data->SetField(key, JsonCodec::ToJson(value));
+		}
+		return this;
+	}
+
+	/* Get a struct field with its JSON_CODEC, fields missing from the JSON keep their value */
+	template<typename T>
+	bool GetStruct(const FString& key, T& outValue) const
+	{
+		static_assert(TJsonCodec<T>::bEnabled, "GetStruct requires a JSON_CODEC for the struct");
+		const TSharedPtr<FJsonValue> field = FindField(key);
+		const TSharedPtr<FJsonObject>* object;
+		if (!field.IsValid() || !field->TryGetObject(object)) {
+			UE_LOG(LogJson, Warning, TEXT("Entry '%s' of type Struct is missing !"), *key);
+			return false;
+		}
+		TJsonCodec<T>::Read(**object, outValue);
+		return true;
+	}
+
+	/* Typed read of a field without building a key string, Default if missing, see JsonAccess.h */
+	template<typename T>
+	T Get(const FJsonKey& key, const T& defaultValue = T()) const
+	{
+		T value = defaultValue;
+		if (const FJsonValue* field = FindKey(key)) {
+			JsonCodec::FromJson(*field, value);
+		}
+		return value;
+	}
+
+	/* Typed write of a field, see JsonAccess.h */
+	template<typename T>
+	UJsonFieldData* Set(const FJsonKey& key, const T& value)
+	{
+		if (PrepareWrite()) {
+			JsonAccess::Set(*Data, key, value);
+		}
+		return this;
+	}
+
+
+	/* Get a class which is already loaded, bLoad loads it synchronously otherwise */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Class Field", AdvancedDisplay = "bLoad"), Category = "JSON")
+	UClass* GetClass(const FString& key, bool bLoad = false) const;
+
+	/* Get classes which are already loaded, bLoad loads the others synchronously */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Class Array Field", AdvancedDisplay = "bLoad"), Category = "JSON")
+	TArray<UClass*> GetClassArray(const FString& key, bool bLoad = false) const;
 
 	/* Get a Texture from a base64 image */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Texture Field"), Category = "JSON")
@@ -242,18 +526,47 @@ public:
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Remove Key"), Category = "JSON")
 	UJsonFieldData* RemoveKey(const FString& key);
 
-	/* Copy to another JSON */
+	/* Independent copy of the JSON, shares the nodes until they are written in copy-on-write mode */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Copy"), Category = "JSON")
 	UJsonFieldData* Copy();
 
+	/* Clone shared objects on their first write instead of writing through to every JSON sharing them */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Copy On Write"), Category = "JSON")
+	UJsonFieldData* SetCopyOnWrite(bool bEnabled);
+
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Is Copy On Write"), Category = "JSON")
+	bool IsCopyOnWrite() const;
+
+	/* Immutable snapshot of the current content, safe to read from any thread, see JsonSnapshot.h */
+	FJsonSnapshot Snapshot();
+
+	/* Read-only JSON of the current content, later writes to this JSON do not change it */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Freeze"), Category = "JSON")
+	UJsonFieldData* Freeze();
+
+	/* Whether writes to this JSON are refused */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Is Frozen"), Category = "JSON")
+	bool IsFrozen() const;
+
+	/* Read-only JSON viewing a snapshot */
+	static UJsonFieldData* CreateFromSnapshot(UObject* WorldContextObject, const FJsonSnapshot& Snapshot);
+
 	/* Creates new data from the input string */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "From String"), Category = "JSON")
 	UJsonFieldData* FromString(const FString& dataString);
 
+	/* Creates new data from the Fields of the input string, paths like "user.name" or "items.*.id", the rest is skipped unread */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "From String Projected"), Category = "JSON")
+	UJsonFieldData* FromStringProjected(const FString& dataString, const TArray<FString>& Fields);
+
 	/* Creates new data from the input compressed JSON string */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "From Archive"), Category = "JSON")
 	UJsonFieldData* FromCompressed(const TArray<uint8>& CompressedData, bool& bIsValid);
 
+	/* Creates new data from the compact binary format */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "From Binary"), Category = "JSON")
+	UJsonFieldData* FromBinary(const TArray<uint8>& BinaryData, bool& bIsValid);
+
 	/* Adds UObject data to the post data */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Add UObject Field"), Category = "JSON")
 	UJsonFieldData* SetUObject(const FString& key, const UObject* value);
@@ -278,17 +591,44 @@ public:
 
 		UJsonFieldData* LocalContext = ExactCast<UJsonFieldData>(P_THIS_OBJECT);
 		if (LocalContext) {
-			LocalContext->Data->SetField(Key, GetJsonValue(Property, DataPtr));
+			LocalContext->SetAnyPropertyInternal(Key, Property, DataPtr);
 		}
 
 		*(UJsonFieldData**)RESULT_PARAM = LocalContext;
 	}
 
+	/* Reads a field written by Add Any Field, the references of an object graph resolve to shared instances */
+	UFUNCTION(BlueprintPure, CustomThunk, meta = (DisplayName = "Get Any Field", CustomStructureParam = "Value"), Category = "JSON")
+	bool GetAnyProperty(const FString& Key, int32& Value);
+
+	DECLARE_FUNCTION(execGetAnyProperty)
+	{
+		P_GET_PROPERTY(FStrProperty, Key);
+		Stack.MostRecentProperty = NULL;
+		Stack.MostRecentPropertyAddress = NULL;
+		Stack.StepCompiledIn<FProperty>(NULL);
+		FProperty* Property = Stack.MostRecentProperty;
+		void* DataPtr = Stack.MostRecentPropertyAddress;
+		P_FINISH;
+
+		UJsonFieldData* LocalContext = ExactCast<UJsonFieldData>(P_THIS_OBJECT);
+		*(bool*)RESULT_PARAM = LocalContext && LocalContext->GetAnyPropertyInternal(Key, Property, DataPtr);
+	}
+
 private:
+	void SetAnyPropertyInternal(const FString& Key, const FProperty* Property, const void* PropertyData);
+	bool GetAnyPropertyInternal(const FString& Key, const FProperty* Property, void* PropertyData);
+
 	static TSharedPtr<FJsonObject> CreateJsonValueFromUObjectProperty(const FObjectProperty * InObjectProperty, const void * InObjectData);
 
 	static TSharedPtr<FJsonObject> CreateJsonValueFromUObject(const UObject* InObject);
 
+	/* Object graph of Root: {"$objects": [...]}, Root is the first entry */
+	static TSharedPtr<FJsonObject> CreateJsonGraphFromUObject(const UObject* Root);
+
+	/* Set the SaveGame properties of Target from the fields of a JSON object, $ fields are skipped */
+	static void SetJsonObjectIntoUObject(const FJsonObject& JsonObject, UObject* Target);
+
 	static TSharedPtr<FJsonObject> CreateJsonValueFromStruct(const FStructProperty* StructProperty, const void* StructPtr);
 
 	static TSharedPtr<FJsonValueArray> CreateJsonValueFromSet(const FSetProperty* SetProperty, const void* SetPtr);
@@ -297,6 +637,9 @@ private:
 
 	static TSharedPtr<FJsonValue> GetJsonValue(const FProperty * InProperty, const void * InPropertyData);
 	static bool SetJsonValueIntoProperty(TSharedPtr<FJsonValue> Value, const FProperty* Property, void* PropertyData);
+	static bool SetJsonArrayIntoProperty(const FJsonValue& Value, const FArrayProperty* ArrayProperty, void* PropertyData);
+	static bool SetJsonSetIntoProperty(const FJsonValue& Value, const FSetProperty* SetProperty, void* PropertyData);
+	static bool SetJsonMapIntoProperty(const FJsonValue& Value, const FMapProperty* MapProperty, void* PropertyData);
 
 	FORCEINLINE static TSharedPtr<FJsonObject> CreateJSONVector(const FVector& value)
 	{
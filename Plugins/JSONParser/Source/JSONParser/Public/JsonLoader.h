@@ -24,11 +24,32 @@ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 #include "Engine/Engine.h"
 
 #include "JsonFieldData.h"
+#include "JsonProjection.h"
+#include "JsonStreamWriter.h"
 #include "JsonLoader.generated.h"
 
 // Event that will be the 'Completed' exec wire in the blueprint node along with all parameters as output pins.
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHttpRequestCompleted, UJsonFieldData*, Json, bool, bSuccess);
 
+/* Timings of an HTTP action, in seconds, filled when the response is handled */
+struct FJsonHttpTimings
+{
+	/* Time at which the request was sent (FPlatformTime::Seconds) */
+	double SentTime = 0.0;
+
+	/* Time from the request to the response */
+	double RoundTrip = 0.0;
+
+	/* Time spent deserializing the response */
+	double Parse = 0.0;
+
+	/* Total time spent on the game thread to handle the response, parse included */
+	double GameThread = 0.0;
+
+	/* Size of the response content */
+	int32 ResponseBytes = 0;
+};
+
 UCLASS() // Change the _API to match your project
 class UJSONAsyncAction_RequestHttpMessage : public UBlueprintAsyncActionBase
 {
@@ -43,14 +64,21 @@ public:
 	/** Execute the actual load */
 	virtual void Activate() override;
 
-	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create JSON Data from HTTP", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
-		static UJSONAsyncAction_RequestHttpMessage* AsyncRequestHTTP(UObject* WorldContextObject, FString URL);
+	/* Fields keeps only those paths of the response, see From String Projected, everything is read when empty */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create JSON Data from HTTP", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject", AutoCreateRefTerm = "Fields"))
+		static UJSONAsyncAction_RequestHttpMessage* AsyncRequestHTTP(UObject* WorldContextObject, FString URL, const TArray<FString>& Fields);
 
 	UPROPERTY(BlueprintAssignable)
 		FOnHttpRequestCompleted Completed;
 
 	/* URL to send GET request to */
 	FString URL;
+
+	/* Fields read from the response, null reads the whole document */
+	TSharedPtr<const FJsonProjection> Projection;
+
+	/* Timings of the last request */
+	FJsonHttpTimings Timings;
 };
 
 UCLASS() // Change the _API to match your project
@@ -67,8 +95,13 @@ public:
 	/** Execute the actual load */
 	virtual void Activate() override;
 
-	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Send JSON data with HTTP", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
-		static UJSONAsyncAction_POSTHttpMessage* AsyncRequestHTTP(UObject* WorldContextObject, FString URL, FString Verb, UJsonFieldData* Json, const TMap<FString, FString>& Header);
+	/* Fields keeps only those paths of the response, everything is read when empty */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Send JSON data with HTTP", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject", AutoCreateRefTerm = "Fields"))
+		static UJSONAsyncAction_POSTHttpMessage* AsyncRequestHTTP(UObject* WorldContextObject, FString URL, FString Verb, UJsonFieldData* Json, const TMap<FString, FString>& Header, const TArray<FString>& Fields);
+
+	/* Closes the writer and sends its document: buffer writers send their bytes, file writers stream the file */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Send JSON Stream with HTTP", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject", AutoCreateRefTerm = "Fields"))
+		static UJSONAsyncAction_POSTHttpMessage* AsyncSendStream(UObject* WorldContextObject, FString URL, FString Verb, UJsonStreamWriter* Writer, const TMap<FString, FString>& Header, const TArray<FString>& Fields);
 
 	UPROPERTY(BlueprintAssignable)
 		FOnHttpRequestCompleted Completed;
@@ -78,6 +111,18 @@ public:
 	FString Verb;
 	FString JSONContent;
 	TMap<FString, FString> Header;
+
+	/* Body written by a stream writer, sent instead of JSONContent */
+	TArray<uint8> Content;
+
+	/* File written by a stream writer, sent from disk */
+	FString ContentFile;
+
+	/* Fields read from the response, null reads the whole document */
+	TSharedPtr<const FJsonProjection> Projection;
+
+	/* Timings of the last request */
+	FJsonHttpTimings Timings;
 };
 
 UCLASS() // Change the _API to match your project
@@ -94,14 +139,18 @@ public:
 	/** Execute the actual load */
 	virtual void Activate() override;
 
-	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create JSON Data from File", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
-		static UJSONAsyncAction_RequestFile* AsyncRequestFile(UObject* WorldContextObject, FString Filename);
+	/* Fields keeps only those paths of the file, everything is read when empty */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create JSON Data from File", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject", AutoCreateRefTerm = "Fields"))
+		static UJSONAsyncAction_RequestFile* AsyncRequestFile(UObject* WorldContextObject, FString Filename, const TArray<FString>& Fields);
 
 	UPROPERTY(BlueprintAssignable)
 		FOnHttpRequestCompleted Completed;
 
 	/* URL to send GET request to */
 	FString Filename;
+
+	/* Fields read from the file, null reads the whole document */
+	TSharedPtr<const FJsonProjection> Projection;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWriteCompleted, bool, Success);
@@ -128,4 +177,263 @@ public:
 	FString Filename;
 	FString JSONContent;
 
-};
\ No newline at end of file
+};
+
+namespace JsonFiles
+{
+	struct FResult;
+}
+
+/* Result of one file of a batch */
+USTRUCT(BlueprintType)
+struct FJsonFileResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	FString Filename;
+
+	/* Loaded JSON, null for saves and failed loads */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	UJsonFieldData* Json = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	bool bSuccess = false;
+
+	/* Seconds spent reading or writing the file */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	float IoTime = 0.f;
+
+	/* Seconds spent parsing or serializing the file */
+	UPROPERTY(BlueprintReadOnly, Category = "JSON")
+	float ProcessTime = 0.f;
+};
+
+// Event with one result per requested file, in order, bSuccess when every file succeeded
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnFilesCompleted, const TArray<FJsonFileResult>&, Results, bool, bSuccess);
+UCLASS() // Change the _API to match your project
+class UJSONAsyncAction_RequestFiles : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	void HandleRequestCompleted(TArray<JsonFiles::FResult>&& Results);
+
+public:
+
+	/** Execute the actual load */
+	virtual void Activate() override;
+
+	/* Read several files at once, repeated paths are read once */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create JSON Data from Files", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
+		static UJSONAsyncAction_RequestFiles* AsyncRequestFiles(UObject* WorldContextObject, const TArray<FString>& Filenames);
+
+	/* Read the files of a directory matching Wildcard */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create JSON Data from Directory", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
+		static UJSONAsyncAction_RequestFiles* AsyncRequestDirectory(UObject* WorldContextObject, FString Directory, FString Wildcard = TEXT("*.json"));
+
+	UPROPERTY(BlueprintAssignable)
+		FOnFilesCompleted Completed;
+
+	TArray<FString> Filenames;
+
+	/* Listed when the action starts if set */
+	FString Directory;
+	FString Wildcard;
+};
+
+UCLASS() // Change the _API to match your project
+class UJSONAsyncAction_SaveFiles : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	void HandleRequestCompleted(TArray<JsonFiles::FResult>&& Results);
+
+public:
+
+	/** Execute the actual save */
+	virtual void Activate() override;
+
+	/* Write each JSON to the file of the same index with its number precision, serialized on worker threads */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Save JSON Data to Files", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
+		static UJSONAsyncAction_SaveFiles* AsyncSaveFiles(UObject* WorldContextObject, const TArray<UJsonFieldData*>& Jsons, const TArray<FString>& Filenames, bool bPretty = true);
+
+	UPROPERTY(BlueprintAssignable)
+		FOnFilesCompleted Completed;
+
+	TArray<FString> Filenames;
+
+	/* Contents captured when the node runs with their number precision, later edits are not saved */
+	TArray<TSharedPtr<const FJsonObject>> Objects;
+	TArray<int32> Decimals;
+	bool bWritePretty = true;
+};
+
+// Event with the decoded texture, null and false when the field is missing or is not an image
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTextureDecoded, UTexture2D*, Texture, bool, bSuccess);
+UCLASS() // Change the _API to match your project
+class UJSONAsyncAction_GetTexture : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	void HandleRequestCompleted(UTexture2D* Texture);
+
+public:
+
+	/** Decode on a worker thread, textures already decoded come from the cache */
+	virtual void Activate() override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Texture Field Async", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
+		static UJSONAsyncAction_GetTexture* AsyncGetTexture(UObject* WorldContextObject, UJsonFieldData* Json, FString Key);
+
+	UPROPERTY(BlueprintAssignable)
+		FOnTextureDecoded Completed;
+
+	/* Base64 image read from the field */
+	FString Source;
+};
+
+// Event with one texture per element, null for the elements which failed, bSuccess if none did
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTexturesDecoded, const TArray<UTexture2D*>&, Textures, bool, bSuccess);
+UCLASS() // Change the _API to match your project
+class UJSONAsyncAction_GetTextureArray : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	void HandleRequestCompleted(int32 Index, UTexture2D* Texture);
+
+public:
+
+	/** Decode every element on worker threads, in parallel */
+	virtual void Activate() override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Texture Array Field Async", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
+		static UJSONAsyncAction_GetTextureArray* AsyncGetTextureArray(UObject* WorldContextObject, UJsonFieldData* Json, FString Key);
+
+	UPROPERTY(BlueprintAssignable)
+		FOnTexturesDecoded Completed;
+
+	/* Base64 images read from the array field */
+	TArray<FString> Sources;
+
+	UPROPERTY()
+		TArray<UTexture2D*> Textures;
+
+	int32 Remaining = 0;
+	bool bSuccess = true;
+};
+
+UCLASS() // Change the _API to match your project
+class UJSONAsyncAction_SetTexture : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	void HandleRequestCompleted(bool bSuccess, const FString& DataUrl);
+
+public:
+
+	/** Read the pixels, then encode them as PNG base64 on a worker thread */
+	virtual void Activate() override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Add Texture Field Async", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
+		static UJSONAsyncAction_SetTexture* AsyncSetTexture(UObject* WorldContextObject, UJsonFieldData* Json, FString Key, UTexture2D* Texture);
+
+	UPROPERTY(BlueprintAssignable)
+		FOnWriteCompleted Completed;
+
+	UPROPERTY()
+		UJsonFieldData* Json = nullptr;
+
+	UPROPERTY()
+		UTexture2D* Texture = nullptr;
+
+	FString Key;
+};
+
+// Event with the loaded class, null and false when the field is missing or the class could not be loaded
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnClassLoaded, UClass*, Class, bool, bSuccess);
+UCLASS() // Change the _API to match your project
+class UJSONAsyncAction_GetClass : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	void HandleRequestCompleted(const TArray<UObject*>& Objects);
+
+public:
+
+	/** Load the class without blocking the game thread */
+	virtual void Activate() override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Class Field Async", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
+		static UJSONAsyncAction_GetClass* AsyncGetClass(UObject* WorldContextObject, UJsonFieldData* Json, FString Key);
+
+	UPROPERTY(BlueprintAssignable)
+		FOnClassLoaded Completed;
+
+	/* Class path read from the field */
+	FString Path;
+};
+
+// Event with one class per element, null for the elements which failed, bSuccess if none did
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnClassesLoaded, const TArray<UClass*>&, Classes, bool, bSuccess);
+UCLASS() // Change the _API to match your project
+class UJSONAsyncAction_GetClassArray : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	void HandleRequestCompleted(const TArray<UObject*>& Objects);
+
+public:
+
+	/** Load every class with a single streamable request */
+	virtual void Activate() override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Class Array Field Async", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
+		static UJSONAsyncAction_GetClassArray* AsyncGetClassArray(UObject* WorldContextObject, UJsonFieldData* Json, FString Key);
+
+	UPROPERTY(BlueprintAssignable)
+		FOnClassesLoaded Completed;
+
+	/* Class paths read from the array field */
+	TArray<FString> Paths;
+};
+
+// Event with one object per path, null for the paths which failed, bSuccess if none did
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnObjectsLoaded, const TArray<UObject*>&, Objects, bool, bSuccess);
+UCLASS() // Change the _API to match your project
+class UJSONAsyncAction_GetSoftObjects : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	void HandleRequestCompleted(const TArray<UObject*>& Objects);
+
+public:
+
+	/** Load every object with a single streamable request */
+	virtual void Activate() override;
+
+	/* Load the objects whose paths are stored under the key, as a string or an array of strings (soft references) */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Load Soft Object Field Async", BlueprintInternalUseOnly = "true", Category = "JSON", WorldContext = "WorldContextObject"))
+		static UJSONAsyncAction_GetSoftObjects* AsyncGetSoftObjects(UObject* WorldContextObject, UJsonFieldData* Json, FString Key);
+
+	UPROPERTY(BlueprintAssignable)
+		FOnObjectsLoaded Completed;
+
+	/* Object paths read from the field */
+	TArray<FString> Paths;
+};
@@ -0,0 +1,66 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fields to keep when parsing a document, the reader skips everything else without building it.
+ * A path is a list of field names separated by dots, "*" matches any name: "user.name", "items.*.id".
+ * Arrays are transparent, the path goes on in every element, and the last name keeps its whole value.
+ * Values met before the end of a path which are neither objects nor arrays are dropped.
+ */
+class JSONPARSER_API FJsonProjection
+{
+public:
+	/* Node returned for fields outside the projection */
+	static constexpr int32 Skip = -2;
+
+	/* Node of a value kept whole */
+	static constexpr int32 KeepAll = -1;
+
+	/* Node of the root object */
+	static constexpr int32 Root = 0;
+
+	FJsonProjection() = default;
+	explicit FJsonProjection(const TArray<FString>& Paths);
+
+	/* An empty projection keeps the whole document */
+	bool IsEmpty() const { return Nodes.Num() == 1 && !Nodes[0].bKeepAll; }
+
+	/* Node of the field Key inside the value at Node, Skip if it is not kept */
+	int32 Find(int32 Node, const FString& Key) const;
+
+private:
+	struct FNode
+	{
+		TMap<FString, int32> Children;
+		int32 Wildcard = Skip;
+		bool bKeepAll = false;
+	};
+
+	int32 AddNode();
+	int32 FindOrAddChild(int32 Node, const FString& Name);
+
+	/* Copy the paths below Source under Target */
+	void Merge(int32 Target, int32 Source);
+
+	/* Names matched by a wildcard also follow the paths of the wildcard */
+	void ResolveWildcards(int32 Node);
+
+	TArray<FNode> Nodes = { FNode() };
+};
@@ -0,0 +1,70 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameFramework/Actor.h"
+
+#include "JsonSaveSubsystem.generated.h"
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnJsonWorldSaved, bool, bSuccess);
+
+struct FJsonSaveBatch;
+
+/**
+ * Saves the SaveGame properties of the registered actors of a world to one JSON (or binary JSON) file.
+ * The game thread only copies the property values into a staging buffer: plain data is copied as is, strings and
+ * containers through their copy constructors. Building the JSON, encoding and writing the file run on worker threads,
+ * one actor per task. Properties holding object references are the exception, they are converted during the capture
+ * since the objects they point at may change or be collected while the workers run.
+ *
+ * File layout: {"actors": {"<actor path>": {"$class": "<class path>", "<property>": value, ...}, ...}}
+ */
+UCLASS()
+class UJsonSaveSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/* Include the actor in the next saves, until it is unregistered or destroyed */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Register Actor"), Category = "JSON|Save")
+	void RegisterActor(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Unregister Actor"), Category = "JSON|Save")
+	void UnregisterActor(AActor* Actor);
+
+	/* Capture the registered actors now and write them in the background, false if a save is already running */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Save World"), Category = "JSON|Save")
+	bool SaveWorld(const FString& Filename, bool bBinary, const FOnJsonWorldSaved& OnSaved);
+
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Is Saving"), Category = "JSON|Save")
+	bool IsSaving() const;
+
+private:
+
+	/* Copy the SaveGame properties of the registered actors, game thread */
+	TSharedRef<FJsonSaveBatch> Capture();
+
+	TArray<TWeakObjectPtr<AActor>> Actors;
+
+	/* Save running on the workers, null when idle */
+	TSharedPtr<FJsonSaveBatch> InFlight;
+};
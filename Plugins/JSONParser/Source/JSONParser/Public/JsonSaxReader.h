@@ -0,0 +1,168 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "JsonSaxReader.generated.h"
+
+/* How an event parse ended */
+UENUM(BlueprintType)
+enum class EJsonSaxResult : uint8
+{
+	/* The whole document was read */
+	Completed,
+
+	/* The handler stopped the parse */
+	Aborted,
+
+	/* The input is not valid JSON, or could not be read */
+	Invalid
+};
+
+/**
+ * Receives the tokens of a document in order, see FJsonSax.
+ * Strings and keys are views valid for the duration of the call only. Return false from any event to stop the parse.
+ */
+class JSONPARSER_API IJsonSaxHandler
+{
+public:
+	virtual ~IJsonSaxHandler() = default;
+
+	virtual bool OnObjectStart() { return true; }
+	virtual bool OnObjectEnd() { return true; }
+	virtual bool OnArrayStart() { return true; }
+	virtual bool OnArrayEnd() { return true; }
+
+	/* Name of the next value, inside objects */
+	virtual bool OnKey(FStringView Key) { return true; }
+
+	virtual bool OnString(FStringView Value) { return true; }
+
+	/* Literal is the number as written, for integers that a double cannot hold exactly */
+	virtual bool OnNumber(double Value, FStringView Literal) { return true; }
+
+	virtual bool OnBool(bool Value) { return true; }
+	virtual bool OnNull() { return true; }
+};
+
+/**
+ * Reads a document as a sequence of events without building it.
+ * The lexer is shared by UTF-16 text and UTF-8 bytes: strings without escapes are handed over in place from text,
+ * other strings are decoded into one reused buffer, so a parse allocates almost nothing whatever the input size.
+ * Any JSON value is accepted as the root.
+ */
+class JSONPARSER_API FJsonSax
+{
+public:
+	/* Nesting deeper than this is rejected, same limit as the DOM reader */
+	static constexpr int32 DefaultMaxDepth = 16384;
+
+	static EJsonSaxResult Parse(FStringView Text, IJsonSaxHandler& Handler, FString* OutError = nullptr, int32 MaxDepth = DefaultMaxDepth);
+
+	/* UTF-8 input, a leading byte order mark is skipped */
+	static EJsonSaxResult ParseUtf8(const UTF8CHAR* Data, int64 Size, IJsonSaxHandler& Handler, FString* OutError = nullptr, int32 MaxDepth = DefaultMaxDepth);
+
+	/* UTF-8 file, mapped in memory when the platform supports it and read whole otherwise */
+	static EJsonSaxResult ParseFile(const FString& Filename, IJsonSaxHandler& Handler, FString* OutError = nullptr, int32 MaxDepth = DefaultMaxDepth);
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnJsonSaxEvent);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJsonSaxString, const FString&, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJsonSaxNumber, double, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJsonSaxBool, bool, Value);
+
+/**
+ * Blueprint side of FJsonSax: bind the events, then parse a string, bytes or a file.
+ * Strings are only converted for the events which are bound. Abort from any event stops the parse after it.
+ */
+UCLASS(BlueprintType)
+class JSONPARSER_API UJsonSaxReader : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/* Creates a reader, bind its events before parsing */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create JSON Event Reader", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"), Category = "JSON|Events")
+	static UJsonSaxReader* Create(UObject* WorldContextObject);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse String"), Category = "JSON|Events")
+	EJsonSaxResult ParseString(const FString& Text);
+
+	/* UTF-8 bytes, as received from HTTP or read from a file */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse Bytes"), Category = "JSON|Events")
+	EJsonSaxResult ParseBytes(const TArray<uint8>& Bytes);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse File"), Category = "JSON|Events")
+	EJsonSaxResult ParseFile(const FString& Filename);
+
+	/* Stops the parse after the current event */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Abort"), Category = "JSON|Events")
+	void Abort();
+
+	/* Number of objects and arrays open at the current event */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Depth"), Category = "JSON|Events")
+	int32 GetDepth() const;
+
+	/* Error of the last parse, empty if it was valid */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Error"), Category = "JSON|Events")
+	FString GetError() const;
+
+	UPROPERTY(BlueprintAssignable, Category = "JSON|Events")
+	FOnJsonSaxEvent OnObjectStart;
+
+	UPROPERTY(BlueprintAssignable, Category = "JSON|Events")
+	FOnJsonSaxEvent OnObjectEnd;
+
+	UPROPERTY(BlueprintAssignable, Category = "JSON|Events")
+	FOnJsonSaxEvent OnArrayStart;
+
+	UPROPERTY(BlueprintAssignable, Category = "JSON|Events")
+	FOnJsonSaxEvent OnArrayEnd;
+
+	UPROPERTY(BlueprintAssignable, Category = "JSON|Events")
+	FOnJsonSaxString OnKey;
+
+	UPROPERTY(BlueprintAssignable, Category = "JSON|Events")
+	FOnJsonSaxString OnString;
+
+	UPROPERTY(BlueprintAssignable, Category = "JSON|Events")
+	FOnJsonSaxNumber OnNumber;
+
+	UPROPERTY(BlueprintAssignable, Category = "JSON|Events")
+	FOnJsonSaxBool OnBool;
+
+	UPROPERTY(BlueprintAssignable, Category = "JSON|Events")
+	FOnJsonSaxEvent OnNull;
+
+	/* Nesting deeper than this is rejected */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JSON|Events")
+	int32 MaxDepth = FJsonSax::DefaultMaxDepth;
+
+private:
+	/* Forwards the events of FJsonSax to the delegates */
+	friend class FJsonSaxReaderHandler;
+
+	/* Resets the state before a parse */
+	void BeginParse();
+
+	bool bAbort = false;
+	int32 Depth = 0;
+	FString Error;
+};
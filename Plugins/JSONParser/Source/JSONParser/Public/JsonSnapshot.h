@@ -0,0 +1,96 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "JsonAccess.h"
+
+/**
+ * Immutable view of a JSON document at the time UJsonFieldData::Snapshot was called.
+ * The document switches to copy-on-write when a snapshot is taken: its next writes clone the objects on their path
+ * and leave every object of the snapshot unchanged, so a snapshot costs nothing to take and a write after it only
+ * copies the objects from the root to the written field. Successive snapshots share every object neither changed.
+ * Nothing in a snapshot is written again, so any number of threads may read it without locking while the game
+ * thread keeps editing the document; the shared pointers are thread safe, the last reader frees the objects.
+ *
+ *	FJsonSnapshot Config = Json->Snapshot();
+ *	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Config]() { Process(Config.Get<float>(JSON_KEY("rate"))); });
+ */
+class JSONPARSER_API FJsonSnapshot
+{
+public:
+	FJsonSnapshot() = default;
+
+	FJsonSnapshot(const TSharedPtr<FJsonObject>& InRoot, uint64 InVersion)
+		: Root(InRoot)
+		, Version(InVersion)
+	{
+	}
+
+	FJsonSnapshot(const FJsonSnapshot&) = default;
+	FJsonSnapshot(FJsonSnapshot&&) = default;
+
+	/* The previous root is released by the destructor of Other */
+	FJsonSnapshot& operator=(FJsonSnapshot Other)
+	{
+		Swap(Root, Other.Root);
+		Version = Other.Version;
+		return *this;
+	}
+
+	/* The last snapshot holding a document releases it without recursion, see JsonTree.h */
+	~FJsonSnapshot();
+
+	bool IsValid() const
+	{
+		return Root.IsValid();
+	}
+
+	const TSharedPtr<const FJsonObject>& GetRoot() const
+	{
+		return Root;
+	}
+
+	/* Incremented by every snapshot of a document which changed since the previous one */
+	uint64 GetVersion() const
+	{
+		return Version;
+	}
+
+	const FJsonObject* operator->() const
+	{
+		return Root.Get();
+	}
+
+	/* Typed read of a root field, Default if missing, see JsonAccess.h */
+	template<typename T>
+	T Get(const FJsonKey& Key, const T& Default = T()) const
+	{
+		return Root.IsValid() ? JsonAccess::Get(*Root, Key, Default) : Default;
+	}
+
+	template<typename T>
+	bool TryGet(const FJsonKey& Key, T& OutValue) const
+	{
+		return Root.IsValid() && JsonAccess::TryGet(*Root, Key, OutValue);
+	}
+
+private:
+	TSharedPtr<const FJsonObject> Root;
+	uint64 Version = 0;
+};
@@ -0,0 +1,127 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "JsonBuilder.h"
+
+#include "JsonStreamWriter.generated.h"
+
+class UJsonFieldData;
+
+/**
+ * Writes a JSON document one value at a time, without building it first: the Blueprint side of FJsonBuilder.
+ * File writers stream the text to disk and keep a constant amount of memory, buffer writers collect the UTF-8 bytes
+ * in memory, for Send JSON Stream with HTTP for instance. Values need a key inside objects, keys are ignored elsewhere.
+ */
+UCLASS(BlueprintType)
+class JSONPARSER_API UJsonStreamWriter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/* Creates a writer streaming to a file, null if the file cannot be created */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create JSON File Writer", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"), Category = "JSON|Stream")
+	static UJsonStreamWriter* CreateFileWriter(UObject* WorldContextObject, const FString& Filename, int32 MaxDecimals = -1);
+
+	/* Creates a writer collecting the document in memory */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create JSON Buffer Writer", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"), Category = "JSON|Stream")
+	static UJsonStreamWriter* CreateBufferWriter(UObject* WorldContextObject, int32 MaxDecimals = -1);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Begin Object"), Category = "JSON|Stream")
+	UJsonStreamWriter* BeginObject(const FString& Key);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "End Object"), Category = "JSON|Stream")
+	UJsonStreamWriter* EndObject();
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Begin Array"), Category = "JSON|Stream")
+	UJsonStreamWriter* BeginArray(const FString& Key);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "End Array"), Category = "JSON|Stream")
+	UJsonStreamWriter* EndArray();
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Write String"), Category = "JSON|Stream")
+	UJsonStreamWriter* WriteString(const FString& Key, const FString& Value);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Write Number"), Category = "JSON|Stream")
+	UJsonStreamWriter* WriteNumber(const FString& Key, double Value);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Write Integer"), Category = "JSON|Stream")
+	UJsonStreamWriter* WriteInteger(const FString& Key, int64 Value);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Write Bool"), Category = "JSON|Stream")
+	UJsonStreamWriter* WriteBool(const FString& Key, bool Value);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Write Null"), Category = "JSON|Stream")
+	UJsonStreamWriter* WriteNull(const FString& Key);
+
+	/* Writes the whole document of a JSON, null if it is not valid */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Write JSON"), Category = "JSON|Stream")
+	UJsonStreamWriter* WriteJson(const FString& Key, UJsonFieldData* Json);
+
+	/* Flushes and closes the output, false if the document is incomplete, a call was invalid or the output failed */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Close"), Category = "JSON|Stream")
+	bool Close();
+
+	/* Text of a buffer writer, once closed */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get String"), Category = "JSON|Stream")
+	FString GetString() const;
+
+	/* UTF-8 bytes of a buffer writer, once closed */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Bytes"), Category = "JSON|Stream")
+	TArray<uint8> GetBytes() const;
+
+	/* Bytes written to the output so far */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Bytes Written"), Category = "JSON|Stream")
+	int64 GetBytesWritten() const;
+
+	/* Moves the bytes of a closed buffer writer out of it */
+	TArray<uint8> TakeBytes();
+
+	/* File of a file writer, empty for buffer writers */
+	const FString& GetFilename() const
+	{
+		return Filename;
+	}
+
+	/* Builder for C++ callers, null once closed */
+	FJsonBuilder* GetBuilder() const
+	{
+		return Builder.Get();
+	}
+
+	virtual void BeginDestroy() override;
+
+private:
+	/* Opens a builder over the archive */
+	void Open(FArchive* InArchive, int32 MaxDecimals);
+
+	/* Writes the key of the next value if in an object, false if no value can be written now */
+	bool BeginValue(const FString& Key, const TCHAR* Call);
+
+	/* Logs a call which does not match the document and fails the writer */
+	void Fail(const TCHAR* Call, const TCHAR* Reason);
+
+	TUniquePtr<FArchive> Archive;
+	TUniquePtr<FJsonBuilder> Builder;
+	TArray<uint8> Bytes;
+	FString Filename;
+	int64 BytesWritten = 0;
+	bool bFailed = false;
+};
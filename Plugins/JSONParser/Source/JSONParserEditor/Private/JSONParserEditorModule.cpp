@@ -0,0 +1,69 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "AssetToolsModule.h"
+#include "AssetTypeActions_Base.h"
+#include "EditorFramework/AssetImportData.h"
+
+#include "JsonDataAsset.h"
+
+/* Content browser entry of UJsonDataAsset, lists its source file for reimport */
+class FAssetTypeActions_JsonDataAsset : public FAssetTypeActions_Base
+{
+public:
+	virtual FText GetName() const override { return NSLOCTEXT("JSONParserEditor", "JsonDataAsset", "JSON Data"); }
+	virtual FColor GetTypeColor() const override { return FColor(255, 196, 64); }
+	virtual UClass* GetSupportedClass() const override { return UJsonDataAsset::StaticClass(); }
+	virtual uint32 GetCategories() override { return EAssetTypeCategories::Misc; }
+	virtual bool IsImportedAsset() const override { return true; }
+
+	virtual void GetResolvedSourceFilePaths(const TArray<UObject*>& TypeAssets, TArray<FString>& OutSourceFilePaths) const override
+	{
+		for (UObject* Asset : TypeAssets) {
+			const UJsonDataAsset* JsonAsset = CastChecked<UJsonDataAsset>(Asset);
+			if (JsonAsset->AssetImportData) {
+				JsonAsset->AssetImportData->ExtractFilenames(OutSourceFilePaths);
+			}
+		}
+	}
+};
+
+class FJSONParserEditorModule : public IModuleInterface
+{
+public:
+
+	virtual void StartupModule() override
+	{
+		IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+		Actions = MakeShared<FAssetTypeActions_JsonDataAsset>();
+		AssetTools.RegisterAssetTypeActions(Actions.ToSharedRef());
+	}
+
+	virtual void ShutdownModule() override
+	{
+		if (Actions.IsValid() && FModuleManager::Get().IsModuleLoaded("AssetTools")) {
+			FModuleManager::GetModuleChecked<FAssetToolsModule>("AssetTools").Get().UnregisterAssetTypeActions(Actions.ToSharedRef());
+		}
+		Actions.Reset();
+	}
+
+private:
+	TSharedPtr<FAssetTypeActions_JsonDataAsset> Actions;
+};
+
+IMPLEMENT_MODULE(FJSONParserEditorModule, JSONParserEditor)
@@ -0,0 +1,102 @@
+/*
+Copyright 2018-2021 Bright Night Games
+
+author: Santamaria Nicolas
+version: 1.0
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "JsonDataAssetFactory.h"
+#include "JsonDataAsset.h"
+#include "JsonGlobals.h"
+
+#include "EditorFramework/AssetImportData.h"
+#include "Editor.h"
+#include "Misc/FileHelper.h"
+#include "Subsystems/ImportSubsystem.h"
+
+UJsonDataAssetFactory::UJsonDataAssetFactory(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SupportedClass = UJsonDataAsset::StaticClass();
+	Formats.Add(TEXT("json;JSON data"));
+	bCreateNew = false;
+	bEditorImport = true;
+	bText = true;
+}
+
+/**
+* Parses the JSON text and stores it as a binary document
+*
+* @return	The new asset, nullptr if the text is not a JSON object
+*/
+UObject* UJsonDataAssetFactory::FactoryCreateText(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags, UObject* Context, const TCHAR* Type, const TCHAR*& Buffer, const TCHAR* BufferEnd, FFeedbackContext* Warn)
+{
+	GEditor->GetEditorSubsystem<UImportSubsystem>()->BroadcastAssetPreImport(this, InClass, InParent, InName, Type);
+
+	UJsonDataAsset* Asset = NewObject<UJsonDataAsset>(InParent, InClass, InName, Flags);
+	if (!Asset->ImportText(FString(BufferEnd - Buffer, Buffer))) {
+		Warn->Logf(ELogVerbosity::Error, TEXT("%s is not a valid JSON object"), *CurrentFilename);
+		GEditor->GetEditorSubsystem<UImportSubsystem>()->BroadcastAssetPostImport(this, nullptr);
+		return nullptr;
+	}
+	Asset->AssetImportData->Update(CurrentFilename);
+
+	GEditor->GetEditorSubsystem<UImportSubsystem>()->BroadcastAssetPostImport(this, Asset);
+	return Asset;
+}
+
+bool UJsonDataAssetFactory::CanReimport(UObject* Obj, TArray<FString>& OutFilenames)
+{
+	const UJsonDataAsset* Asset = Cast<UJsonDataAsset>(Obj);
+	if (Asset && Asset->AssetImportData) {
+		Asset->AssetImportData->ExtractFilenames(OutFilenames);
+		return true;
+	}
+	return false;
+}
+
+void UJsonDataAssetFactory::SetReimportPaths(UObject* Obj, const TArray<FString>& NewReimportPaths)
+{
+	UJsonDataAsset* Asset = Cast<UJsonDataAsset>(Obj);
+	if (Asset && Asset->AssetImportData && ensure(NewReimportPaths.Num() == 1)) {
+		Asset->AssetImportData->UpdateFilenameOnly(NewReimportPaths[0]);
+	}
+}
+
+EReimportResult::Type UJsonDataAssetFactory::Reimport(UObject* Obj)
+{
+	UJsonDataAsset* Asset = Cast<UJsonDataAsset>(Obj);
+	if (!Asset || !Asset->AssetImportData) {
+		return EReimportResult::Failed;
+	}
+
+	const FString Filename = Asset->AssetImportData->GetFirstFilename();
+	FString Text;
+	if (Filename.IsEmpty() || !FFileHelper::LoadFileToString(Text, *Filename)) {
+		UE_LOG(LogJson, Warning, TEXT("Cannot reimport %s, %s cannot be read"), *Asset->GetName(), *Filename);
+		return EReimportResult::Failed;
+	}
+
+	if (!Asset->ImportText(Text)) {
+		UE_LOG(LogJson, Warning, TEXT("Cannot reimport %s, %s is not a valid JSON object"), *Asset->GetName(), *Filename);
+		return EReimportResult::Failed;
+	}
+
+	Asset->AssetImportData->Update(Filename);
+	Asset->MarkPackageDirty();
+	return EReimportResult::Succeeded;
+}
+
+int32 UJsonDataAssetFactory::GetPriority() const
+{
+	return ImportPriority;
+}